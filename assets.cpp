@@ -0,0 +1,26 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include "assets.h"
+#include "config.h"
+
+std::map<std::string, sf::Font> Assets::fonts;
+
+sf::Font &Assets::font(const std::string &path) {
+    auto found = fonts.find(path);
+    if (found != fonts.end()) return found->second;
+
+    // std::map never moves its elements, so this
+    // reference is stable
+    sf::Font &font = fonts[path];
+    font.loadFromFile(path);
+
+    return font;
+}
+
+void Assets::preload() {
+    font(TITLE_FONT);
+    font(BODY_FONT);
+    font(HEADER_FONT);
+}
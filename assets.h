@@ -0,0 +1,31 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_ASSETS_H
+#define SOLAR_SYSTEM_ASSETS_H
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <string>
+
+/** class Assets
+ *
+ * A process-wide cache of the files the game loads, keyed
+ * by path. Each one is only read from disk the first time
+ * it's asked for, and the references it hands out stay
+ * valid for the rest of the program.
+ */
+class Assets {
+    static std::map<std::string, sf::Font> fonts;
+
+public:
+    // Gets the font at the given path, loading it if needed
+    static sf::Font &font(const std::string &path);
+
+    // Loads every font the game uses, so that nothing
+    // has to be read from disk mid-game
+    static void preload();
+};
+
+#endif //SOLAR_SYSTEM_ASSETS_H
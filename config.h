@@ -5,25 +5,32 @@
 #ifndef SOLAR_SYSTEM_CONFIG_H
 #define SOLAR_SYSTEM_CONFIG_H
 
+#include "display_metrics.h"
+#include "scenario.h"
 
 /** Meta **/
 
 #define ASSUMED_WIDTH 1920.f
-#define WIDTH_RATIO (sf::VideoMode::getDesktopMode().width / ASSUMED_WIDTH)
+#define WIDTH_RATIO (DisplayMetrics::widthRatio)
 #define N(n) ((n) * WIDTH_RATIO)
 
-// The dimensions of the window
-#define WIDTH N(1000)
-#define HEIGHT N(700)
-#define HALF_WIDTH (WIDTH / 2)
-#define HALF_HEIGHT (HEIGHT / 2)
+// The dimensions of the window, before scaling
+#define VIRTUAL_WIDTH 1000.f
+#define VIRTUAL_HEIGHT 700.f
+
+// The dimensions of the window. These and the
+// rest are worked out once, by DisplayMetrics.
+#define WIDTH (DisplayMetrics::width)
+#define HEIGHT (DisplayMetrics::height)
+#define HALF_WIDTH (DisplayMetrics::halfWidth)
+#define HALF_HEIGHT (DisplayMetrics::halfHeight)
 
 // The size of the sidebar
-#define SIDEBAR_WIDTH (WIDTH - HEIGHT)
+#define SIDEBAR_WIDTH (DisplayMetrics::sidebarWidth)
 
 // Positioning of the solar system
-#define SYSTEM_X (HALF_WIDTH + (SIDEBAR_WIDTH / 2))
-#define SYSTEM_Y HALF_HEIGHT
+#define SYSTEM_X (DisplayMetrics::systemX)
+#define SYSTEM_Y (DisplayMetrics::systemY)
 #define SYSTEM_CENTER sf::Vector2f(SYSTEM_X, SYSTEM_Y)
 
 // Font sizes
@@ -46,10 +53,39 @@
 #define DRAG_LINE_WIDTH N(2)
 
 // 1 game year = TIMESCALE real minutes
-#define TIMESCALE 2
+#define TIMESCALE (Scenario::current.timescale)
+
+// The bounds of the time warp, which speeds up the game
+// by a power of ten, and the number of ticks it may take
+// per frame before it starts falling behind
+#define MIN_TIME_WARP 1
+#define MAX_TIME_WARP 10000
+#define MAX_TICKS_PER_FRAME 10000
+
+// The length (in seconds) of a fixed simulation tick
+#define TICK_LENGTH_S (1.f / 60.f)
+
+// When fast forwarding, the number of ticks at the end
+// which are stepped normally rather than jumped over
+#define FAST_FORWARD_SETTLE_TICKS 64
+
+// The jump itself is split into steps of at most this many
+// seconds, so the relationships follow the planets around
+// their orbits rather than all changing at once
+#define FAST_FORWARD_STEP_S 10
 
-// Time (in seconds) between sidebar updates
-#define SIDEBAR_UPDATE_TIME_S 1.0f
+// Where F5 saves the game to, and F9 loads it from
+#define SAVE_FILE "solar_system.save"
+
+// Where each new game's journal is written, and how many
+// ticks apart the checksums in it are
+#define JOURNAL_FILE "solar_system.journal"
+#define JOURNAL_CHECKSUM_TICKS 3600
+
+/** Assets **/
+#define TITLE_FONT  "../assets/fonts/EspressoDolce.ttf"
+#define BODY_FONT   "../assets/fonts/Cabin-Regular.ttf"
+#define HEADER_FONT "../assets/fonts/Cabin-Bold.ttf"
 
 /** Constants **/
 #define PI            3.14159f
@@ -80,10 +116,13 @@
 
 /** Planets **/
 
+// The planet and ship settings below come from the
+// scenario, so they can be changed without a rebuild
+
 // The bounds of possible population.
 // Note: population also has a chance to be 0
-#define MIN_POPULATION 1000
-#define MAX_POPULATION 5000000
+#define MIN_POPULATION (Scenario::current.minPopulation)
+#define MAX_POPULATION (Scenario::current.maxPopulation)
 
 // Bounds of possible density.
 // Should probably be tweaked.
@@ -104,24 +143,66 @@
 #define PLANET_BORDER_THICKNESS N(2)
 
 // The bounds of planet speed
-#define MIN_PLANET_SPEED 25
-#define MAX_PLANET_SPEED 40
+#define MIN_PLANET_SPEED (Scenario::current.minPlanetSpeed)
+#define MAX_PLANET_SPEED (Scenario::current.maxPlanetSpeed)
 
 // The radius (in pixels) of the sun
 #define SUN_RADIUS 60
 
+// The size of the cells in the grid used to find
+// the planet under the mouse
+#define PLANET_GRID_CELL_SIZE N(40)
+
 // The number of planets to generate
-#define NUM_PLANETS 5
+#define NUM_PLANETS (Scenario::current.numPlanets)
 
 // The minimum and maximum number of inhabited planets
-#define MIN_REQ_INHABITED 2
-#define MAX_REQ_INHABITED 4
+#define MIN_REQ_INHABITED (Scenario::current.minInhabited)
+#define MAX_REQ_INHABITED (Scenario::current.maxInhabited)
+
+// The chance of each planet being inhabited, before
+// the number inhabited is held within the bounds
+#define INHABITED_CHANCE 0.6
+
+// With fewer planets than this, generating them
+// isn't worth spreading over threads
+#define GENERATION_PARALLEL_MIN_PLANETS 4096
 
 // The minimum and maximum relation bounds
 #define MIN_PLANET_REL (-1.f)
 #define MAX_PLANET_REL (+1.f)
 
 
+/** Relationships **/
+
+// How quickly (per second) each relationship relaxes towards
+// the average reputation of the two planets
+#define REL_DIFFUSION_RATE 0.002f
+
+// Planets closer than this many pixels slowly warm
+// to each other, by up to REL_PROXIMITY_RATE per second
+#define REL_PROXIMITY_RANGE N(150)
+#define REL_PROXIMITY_RATE 0.001f
+
+// Armed planets sour their relationships, by up to
+// REL_WEAPONARY_RATE per second at MAX_WEAPONARY
+#define REL_WEAPONARY_RATE 0.0005f
+#define MAX_WEAPONARY 10000
+
+// A delivered ship improves the relationship by this
+// much for every MAX_CARGO_PER_RESOURCE it carries
+#define REL_TRADE_BONUS 0.02f
+
+// With fewer planets than this, the relationship
+// dynamics aren't worth spreading over threads
+#define REL_PARALLEL_MIN_PLANETS 256
+
+// Above that, the rows are split into this many blocks, however
+// many threads there are, so the reputations are always summed
+// in the same order
+#define REL_BLOCKS 32
+
+
 /** Spaceships **/
 
 #define SHIP_RADIUS N(2)
@@ -130,8 +211,12 @@
 #define SHIP_SPEED N(15)
 #define SHIP_DRAG N(0.25)
 
+// The speed (in px/s) ships settle at, when their
+// acceleration is balanced by the drag
+#define SHIP_CRUISE_SPEED (SHIP_SPEED * SHIP_DRAG / (1 - SHIP_DRAG))
+
 // Ships can only carry this many of each resource
-#define MAX_CARGO_PER_RESOURCE 5000L
+#define MAX_CARGO_PER_RESOURCE (Scenario::current.maxCargoPerResource)
 
 // Each ship consumes this much metal from the sender
 #define SHIP_METAL_USAGE 500
@@ -0,0 +1,41 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <SFML/Window.hpp>
+
+#include "config.h"
+#include "display_metrics.h"
+
+float DisplayMetrics::widthRatio = 1.f;
+float DisplayMetrics::width = VIRTUAL_WIDTH;
+float DisplayMetrics::height = VIRTUAL_HEIGHT;
+float DisplayMetrics::halfWidth = VIRTUAL_WIDTH / 2;
+float DisplayMetrics::halfHeight = VIRTUAL_HEIGHT / 2;
+float DisplayMetrics::sidebarWidth = VIRTUAL_WIDTH - VIRTUAL_HEIGHT;
+float DisplayMetrics::systemX = VIRTUAL_WIDTH / 2 + (VIRTUAL_WIDTH - VIRTUAL_HEIGHT) / 2;
+float DisplayMetrics::systemY = VIRTUAL_HEIGHT / 2;
+
+void DisplayMetrics::init(bool headless) {
+    if (headless) {
+        resize(ASSUMED_WIDTH);
+    } else {
+        resize(sf::VideoMode::getDesktopMode().width);
+    }
+}
+
+void DisplayMetrics::resize(float desktopWidth) {
+    widthRatio = desktopWidth / ASSUMED_WIDTH;
+
+    width = VIRTUAL_WIDTH * widthRatio;
+    height = VIRTUAL_HEIGHT * widthRatio;
+    halfWidth = width / 2;
+    halfHeight = height / 2;
+
+    // The sidebar takes what's left of the width
+    // once the square system view is taken out
+    sidebarWidth = width - height;
+
+    systemX = halfWidth + sidebarWidth / 2;
+    systemY = halfHeight;
+}
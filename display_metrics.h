@@ -0,0 +1,39 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_DISPLAY_METRICS_H
+#define SOLAR_SYSTEM_DISPLAY_METRICS_H
+
+/** class DisplayMetrics
+ *
+ * Holds the display measurements which the sizing macros
+ * in config.h read. They're resolved once at startup (and
+ * again on an explicit resize), so the rest of the game
+ * never has to query the desktop mode, which also needs a
+ * display to be present.
+ */
+class DisplayMetrics {
+public:
+    // The ratio of the desktop width to ASSUMED_WIDTH, which
+    // every size in the game is scaled by
+    static float widthRatio;
+
+    // The window and the regions within it, in pixels
+    static float width, height;
+    static float halfWidth, halfHeight;
+    static float sidebarWidth;
+
+    // The centre of the solar system
+    static float systemX, systemY;
+
+    // Resolves the metrics from the desktop. A headless game
+    // doesn't have one, so it uses a virtual desktop which is
+    // ASSUMED_WIDTH wide, making the layout the same everywhere.
+    static void init(bool headless);
+
+    // Re-resolves the metrics for a desktop of the given width
+    static void resize(float desktopWidth);
+};
+
+#endif //SOLAR_SYSTEM_DISPLAY_METRICS_H
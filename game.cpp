@@ -2,71 +2,195 @@
 // Created by Zac G on 08/10/2017.
 //
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <thread>
+
+#include "assets.h"
 #include "config.h"
 #include "game.h"
+#include "planet_kernels.h"
+#include "text_buffer.h"
 
-Game::Game() {
-    font.loadFromFile("../assets/fonts/Cabin-Bold.ttf");
-    yearDisplay = sf::Text("", font, REGULAR_FONT_SIZE);
+Game::Game(uint64_t seed, bool headless): headless(headless), seed(seed), sidebar(nullptr), dragging(false) {
+    store.seed = seed;
+
+    generatePlanets();
+
+    relationships = new PlanetRelationships(planets.size());
+
+    // A game in a window is journalled, so it can be reproduced
+    if (!headless) {
+        JournalHeader header = {};
+        header.desktopWidth = WIDTH_RATIO * ASSUMED_WIDTH;
+        header.seed = seed;
+        header.scenario = Scenario::current;
+        header.kernelLevel = planetKernelLevel();
+
+        journal = new Journal(JOURNAL_FILE, header);
+    }
+
+    setUpInterface();
+}
+
+Game::~Game() {
+    delete relationships;
+    delete journal;
+    delete inspector;
+    delete designer;
+}
+
+void Game::setUpInterface() {
+    // Nothing here is needed to simulate the game
+    if (headless) return;
+
+    for (auto &planet : planets) {
+        visuals.push_back(PlanetVisual(planet));
+    }
+
+    planetGrid = SpatialGrid(WIDTH, HEIGHT, PLANET_GRID_CELL_SIZE);
+    planetGrid.update(store.x.data(), store.y.data(), store.pixelRadius.data(), store.size());
+
+    yearDisplay = sf::Text("", Assets::font(HEADER_FONT), REGULAR_FONT_SIZE);
     yearDisplay.setFillColor(sf::Color(BRIGHT_FG));
 
-    sidebar = new PlanetInspector(nullptr);
+    inspector = new PlanetInspector();
+    designer = new ShipDesigner(this);
+    sidebar = inspector;
 
     sun = sf::CircleShape(SUN_RADIUS, 50);
     sun.setPosition(SYSTEM_X, SYSTEM_Y);
     sun.setFillColor(sf::Color::Yellow);
     sun.setOrigin(SUN_RADIUS, SUN_RADIUS);
 
-    std::vector<Planet*> pptrs = generatePlanets();
-
-    relationships = new PlanetRelationships(pptrs);
-
     dragLine = sf::RectangleShape(sf::Vector2f(DRAG_LINE_WIDTH, DRAG_LINE_WIDTH));
     dragLine.setOrigin(DRAG_LINE_WIDTH / 2, DRAG_LINE_WIDTH / 2);
     dragLine.setFillColor(sf::Color(DRAG_LINE_COLOUR));
+
+    edgeVertices.setPrimitiveType(sf::Quads);
 }
 
-Scene *Game::update(float dt) {
-    elapsed += dt * 1000;
+void Game::step(float dt) {
+    if (journal != nullptr && store.tick % JOURNAL_CHECKSUM_TICKS == 0) {
+        JournalRecord record = {};
+        record.tick = store.tick;
+        record.action = ChecksumAction;
+        record.checksum = checksum();
 
-    for (auto &planet : planets) {
-        planet.update(this, dt);
+        journal->record(record);
     }
 
-    for (auto &ship : ships) {
-        ship.update(dt);
+    elapsed += llround(dt * 1E+6);
 
-        if (ship.delivered) {
-            // Remove the ship if it's got to its destination
+    store.update(dt, SYSTEM_X, SYSTEM_Y);
 
-            int index = -1;
+    if (!headless) planetGrid.update(store.x.data(), store.y.data(), store.pixelRadius.data(), store.size());
 
-            for (int i = 0; (unsigned)i < ships.size(); i++) {
-                if (ships[i].id == ship.id) {
-                    index = i;
-                    break;
-                }
-            }
+    // Only the ships which are due to arrive are looked at. Any
+    // that have been thrown off course are given a new path.
+    while (!arrivals.empty() && arrivals.top().due <= elapsed) {
+        ShipHandle handle = arrivals.top().ship;
+        arrivals.pop();
 
-            if (index >= 0) {
-                ships.erase(ships.begin() + index);
-            }
+        Spaceship *ship = ships.get(handle);
+        if (ship == nullptr) continue;
+
+        if (ship->hasReachedDestination(elapsed)) {
+            ship->deliver();
+            dynamics.recordTrade(ship->getSender()->index, ship->getDestination()->index, ship->resources);
+            ships.remove(handle);
+        } else {
+            ship->replan(elapsed);
+            arrivals.push({ship->arrivalTime, handle});
+        }
+    }
 
-            // Update the sidebar
-            if (auto pi = dynamic_cast<PlanetInspector*>(sidebar)) {
-                sidebar = new PlanetInspector(pi->planet);
+    ships.compact();
+
+    dynamics.update(*relationships, store, dt);
+}
+
+void Game::fastForward(double duration) {
+    uint64_t ticks = uint64_t(duration / TICK_LENGTH_S);
+
+    // The last few ticks are always stepped, to let the
+    // resources settle after the jump
+    uint64_t jump = ticks > FAST_FORWARD_SETTLE_TICKS ? ticks - FAST_FORWARD_SETTLE_TICKS : 0;
+
+    // The relationships are clamped every update, so one huge step
+    // would pin them all to the ends. Stepping a bounded stretch at
+    // a time keeps every change small, as it is tick by tick.
+    uint64_t stepTicks = std::max(uint64_t(1), uint64_t(FAST_FORWARD_STEP_S / TICK_LENGTH_S));
+
+    for (uint64_t done = 0; done < jump; ) {
+        uint64_t count = std::min(stepTicks, jump - done);
+
+        // Deliver the ships which would've arrived by the end of
+        // this step. The rest just carry on along their paths. The
+        // clock is rounded per tick, exactly as step() rounds it.
+        elapsed += count * llround(TICK_LENGTH_S * 1E+6);
+
+        while (!arrivals.empty() && arrivals.top().due <= elapsed) {
+            Spaceship *ship = ships.get(arrivals.top().ship);
+
+            if (ship != nullptr) {
+                ship->deliver();
+                dynamics.recordTrade(ship->getSender()->index, ship->getDestination()->index, ship->resources);
+                ships.remove(arrivals.top().ship);
             }
+
+            arrivals.pop();
         }
+
+        ships.compact();
+
+        store.fastForward(count, TICK_LENGTH_S, SYSTEM_X, SYSTEM_Y);
+        dynamics.update(*relationships, store, float(count * TICK_LENGTH_S));
+
+        done += count;
     }
 
-    int date, month, year;
-    std::tie(date, month, year) = getDate();
+    for (uint64_t i = jump; i < ticks; i++) {
+        step(TICK_LENGTH_S);
+    }
+}
 
-    yearDisplay.setString(std::to_string(date) + "/" + std::to_string(month) + "/" + std::to_string(year));
+Scene *Game::update(float dt) {
+    // Run the simulation in fixed ticks, however much time has been
+    // warped into this frame. If there's too much to catch up on,
+    // the rest is dropped, so the game slows down instead of stalling.
+    unticked += dt * timeWarp;
+
+    int ticks = 0;
+    while (unticked >= TICK_LENGTH_S && ticks < MAX_TICKS_PER_FRAME) {
+        step(TICK_LENGTH_S);
+        unticked -= TICK_LENGTH_S;
+        ticks++;
+    }
 
-    sidebar->update(dt);
+    if (ticks == MAX_TICKS_PER_FRAME) unticked = 0;
+
+    std::tuple<int, int, int> today = getDate();
+
+    if (today != shownDate || timeWarp != shownWarp) {
+        shownDate = today;
+        shownWarp = timeWarp;
+
+        int date, month, year;
+        std::tie(date, month, year) = today;
 
-    getDate();
+        TextBuffer display;
+        display.appendNumber(date).append('/').appendNumber(month).append('/').appendNumber(year);
+        if (timeWarp > MIN_TIME_WARP) display.append("  x").appendNumber(timeWarp);
+
+        yearDisplay.setString(display.c_str());
+    }
+
+    sidebar->update(dt);
 
     return nullptr;
 }
@@ -74,14 +198,18 @@ Scene *Game::update(float dt) {
 void Game::render(sf::RenderWindow *win) {
     positionDragLine(win);
 
-    win->draw(sun);
+    // The sun and orbits never move, so they're only redrawn when
+    // the planets or the window change
+    if (backgroundDirty || background.getSize() != win->getSize()) renderBackground(win);
 
-    for (auto &planet : planets) {
-        planet.renderOrbit(win);
+    win->draw(backgroundSprite);
+
+    for (unsigned int i = 0; i < visuals.size(); i++) {
+        visuals[i].update(planets[i]);
     }
 
     if (nullptr != selected) {
-        selected->renderBorder(win);
+        visuals[selected->index].renderBorder(win);
     }
 
     renderRelationships(win);
@@ -89,11 +217,11 @@ void Game::render(sf::RenderWindow *win) {
     if (dragging) win->draw(dragLine);
 
     for (auto &ship : ships) {
-        ship.render(win);
+        ship.render(win, elapsed);
     }
 
-    for (auto &planet : planets) {
-        planet.render(win);
+    for (auto &visual : visuals) {
+        visual.render(win);
     }
 
     sf::FloatRect ydBounds = yearDisplay.getGlobalBounds();
@@ -111,10 +239,27 @@ Scene *Game::handleEvent(sf::Event *event) {
             switch (event->key.code) {
                 case sf::Keyboard::Escape:
                     return new MainMenu();
+                case sf::Keyboard::Period:
+                    setTimeWarp(timeWarp * 10);
+                    return nullptr;
+                case sf::Keyboard::Comma:
+                    setTimeWarp(timeWarp / 10);
+                    return nullptr;
+                case sf::Keyboard::F5:
+                    save(SAVE_FILE);
+                    return nullptr;
+                case sf::Keyboard::F9:
+                    // Carry on with this game if the save can't be loaded
+                    return load(SAVE_FILE);
                 default:
                     return nullptr;
             }
 
+        case sf::Event::Resized:
+            backgroundDirty = true;
+            edgesDirty = true;
+            break;
+
         case sf::Event::MouseButtonPressed:
             pos = sf::Vector2f(event->mouseButton.x, event->mouseButton.y);
 
@@ -154,20 +299,17 @@ void Game::mouseDown(sf::Vector2f pos) {
     dragging = false;
 
     if (pos.x > SIDEBAR_WIDTH) {
-        selectPlanet(nullptr);
+        Planet *planet = planetAt(pos);
 
-        bool found = false;
-        for (auto &planet : planets) {
-            if (planet.contains(pos)) {
-                selectPlanet(&planet);
-                found = true;
+        selectPlanet(planet);
+        if (planet != nullptr) dragging = true;
+    }
+}
 
-                break;
-            }
-        }
+Planet *Game::planetAt(sf::Vector2f pos) {
+    int index = planetGrid.find(pos.x, pos.y, store.x.data(), store.y.data(), store.pixelRadius.data());
 
-        if (found) dragging = true;
-    }
+    return index < 0 ? nullptr : &planets[index];
 }
 
 void Game::mouseUp(sf::Vector2f pos) {
@@ -175,33 +317,54 @@ void Game::mouseUp(sf::Vector2f pos) {
 
     if (selected == nullptr) return;
 
-    for (auto &planet : planets) {
-
-        // If the planet is moused over, isn't selected and is populated.
-        if (planet.contains(pos) &&
-                selected != &planet &&
-                selected->isInhabited()) {
-            sidebar = new ShipDesigner(this, selected, &planet);
+    Planet *planet = planetAt(pos);
 
-            break;
-        }
+    // If a planet is moused over, isn't selected and the selected one is populated.
+    if (planet != nullptr && planet != selected && selected->isInhabited()) {
+        designer->setPlanets(selected, planet);
+        sidebar = designer;
     }
 }
 
 void Game::selectPlanet(Planet *planet) {
-    sidebar = new PlanetInspector(planet);
+    inspector->setPlanet(planet);
+    sidebar = inspector;
     selected = planet;
 }
 
+void Game::setTimeWarp(int warp) {
+    timeWarp = std::max(MIN_TIME_WARP, std::min(MAX_TIME_WARP, warp));
+}
+
 void Game::removeSidebar() {
-    sidebar = new PlanetInspector(nullptr);
+    inspector->setPlanet(nullptr);
+    sidebar = inspector;
+}
+
+void Game::launchShip(Planet *sender, Planet *destination, Resources resources) {
+    if (journal != nullptr) {
+        JournalRecord record = {};
+        record.tick = store.tick;
+        record.action = LaunchAction;
+        record.sender = sender->index;
+        record.destination = destination->index;
+        memcpy(record.resources, resources.store, sizeof(record.resources));
+
+        journal->record(record);
+    }
+
+    sender->setResource(Metal, sender->resource(Metal) - SHIP_METAL_USAGE);
+    if (!(sender->getResources() > resources)) return;
+
+    ShipHandle handle = ships.add(Spaceship(sender, destination, resources, elapsed));
+    arrivals.push({ships.get(handle)->arrivalTime, handle});
 }
 
 void Game::positionDragLine(sf::Window *win) {
     if (selected == nullptr) return;
 
     sf::Vector2f mouse = sf::Vector2f(sf::Mouse::getPosition(*win));
-    sf::Vector2f selPos = selected->getPosition(SYSTEM_CENTER);
+    sf::Vector2f selPos = selected->getPosition();
     sf::Vector2f diff = mouse - selPos;
 
     float length = sqrtf(diff.x * diff.x + diff.y * diff.y);
@@ -212,95 +375,513 @@ void Game::positionDragLine(sf::Window *win) {
     dragLine.setRotation(-angle * (180 / PI) + 90);
 }
 
+void Game::renderBackground(sf::RenderWindow *win) {
+    sf::Vector2u size = win->getSize();
+
+    // The layer is drawn first, so it can be opaque
+    background.create(size.x, size.y);
+    background.clear(sf::Color(CLEAR_COLOUR));
+
+    background.draw(sun);
+
+    for (auto &visual : visuals) {
+        visual.renderOrbit(&background);
+    }
+
+    background.display();
+
+    backgroundSprite.setTexture(background.getTexture(), true);
+    backgroundDirty = false;
+}
+
 void Game::renderRelationships(sf::RenderWindow *win) {
-    std::vector<std::tuple<Planet*, Planet*, float>> edges;
+    if (edgesDirty || edgesTick != store.tick || edgesSelected != selected) {
+        buildEdgeVertices();
 
-    if (selected != nullptr) {
-        for (auto &edge : relationships->relations) {
-            if (edge.first.first == selected || edge.first.second == selected)
-                edges.push_back(std::make_tuple(edge.first.first, edge.first.second, edge.second));
-        }
-    } else {
-        for (auto &edge : relationships->relations) edges.push_back(std::make_tuple(edge.first.first, edge.first.second, edge.second));
+        edgesDirty = false;
+        edgesTick = store.tick;
+        edgesSelected = selected;
     }
 
-    for (auto &edge : edges) {
-        float relationship;
-        Planet *a, *b;
+    win->draw(edgeVertices);
+}
+
+void Game::buildEdgeVertices() {
+    const float *x = store.x.data(), *y = store.y.data();
+    float width = N(1.5f);
 
-        std::tie(a, b, relationship) = edge;
+    unsigned int quads = 0;
 
-        sf::Vector2f diff = b->getPosition(SYSTEM_CENTER) - a->getPosition(SYSTEM_CENTER);
+    // Adds a quad for the edge between planets a and b, from a's
+    // centre towards b's, extending width to one side
+    auto addEdge = [&](unsigned int a, unsigned int b, float relationship) {
+        sf::Vector2f from(x[a], y[a]), to(x[b], y[b]);
+        sf::Vector2f diff = to - from;
         float length = sqrtf(diff.x * diff.x + diff.y * diff.y);
-        float angle = atan2f(diff.x, diff.y);
+        if (length == 0) return;
+
+        sf::Vector2f side = sf::Vector2f(-diff.y, diff.x) * (width / length);
 
         float r = 128 * -relationship + 127;
         float g = 256 - r;
-        float alpha = abs(relationship) * 80;
+        float alpha = std::abs(relationship) * 80;
+        sf::Color colour(sf::Uint8(r), sf::Uint8(g), 0, sf::Uint8(alpha));
+
+        sf::Vertex *quad = &edgeVertices[quads++ * 4];
+        quad[0] = sf::Vertex(from, colour);
+        quad[1] = sf::Vertex(to, colour);
+        quad[2] = sf::Vertex(to + side, colour);
+        quad[3] = sf::Vertex(from + side, colour);
+    };
+
+    unsigned int n = planets.size();
+
+    if (selected != nullptr) {
+        edgeVertices.resize((n - 1) * 4);
 
-        sf::RectangleShape rect(sf::Vector2f(length, N(1.5f)));
-        rect.setFillColor(sf::Color(sf::Uint8(r), sf::Uint8(g), 0, sf::Uint8(alpha)));
-        rect.setPosition(a->getPosition(SYSTEM_CENTER));
-        rect.setRotation(-angle * (180 / PI) + 90);
-        win->draw(rect);
+        for (auto edge : relationships->edgesOf(selected->index)) {
+            addEdge(selected->index, edge.other, edge.relationship);
+        }
+    } else {
+        edgeVertices.resize(size_t(n) * (n - 1) / 2 * 4);
+
+        for (unsigned int a = 0; a < n; a++) {
+            for (unsigned int b = a + 1; b < n; b++) {
+                addEdge(a, b, relationships->get(a, b));
+            }
+        }
     }
+
+    // Drop any quads left over from edges too short to draw
+    edgeVertices.resize(quads * 4);
 }
 
 std::tuple<int, int, int> Game::getDate() {
-    int millisPerDay = (TIMESCALE * 60 * 1000) / 365;
-    int day = elapsed / millisPerDay;
+    uint64_t microsPerDay = (TIMESCALE * 60 * 1000) / 365 * 1000;
+    uint64_t day = elapsed / microsPerDay;
 
-    int months[] = {
-            31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+    // The first day of each month, within a year
+    static const int monthStarts[] = {
+            0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365
     };
 
-    int date = 0, month = 0, year = 0, daysLeft = months[month];
+    // The date is counted from 1 after the first day has passed
+    if (day == 0) return std::make_tuple(0, 1, 0);
 
-    for (int i = 0; i < day; i++) {
-        if (daysLeft == 0) {
-            month++;
-            date = 0;
+    int year = int((day - 1) / 365);
+    int dayOfYear = int((day - 1) % 365);
 
-            if (month >= 12) {
-                month = 0;
-                year++;
-            }
+    int month = 0;
+    while (dayOfYear >= monthStarts[month + 1]) month++;
+
+    return std::make_tuple(dayOfYear - monthStarts[month] + 1, month + 1, year);
+}
+
+// The log of the chance of exactly k of n planets being inhabited,
+// if each is inhabited with INHABITED_CHANCE, give or take a constant
+static double logInhabitedChance(int n, int k) {
+    return -lgamma(k + 1.0) - lgamma(n - k + 1.0)
+           + k * log(INHABITED_CHANCE) + (n - k) * log(1 - INHABITED_CHANCE);
+}
+
+// Draws how many of n planets are inhabited, if each is inhabited by
+// chance but the total must be within [min, max]. That's a truncated
+// binomial, which is drawn from directly rather than by retrying.
+static int randomInhabitedCount(Random &random, int n, int min, int max) {
+    // The chances fall away on both sides of the most likely count,
+    // so only the counts around it which aren't vanishingly rare
+    // need to be considered
+    int mode = std::min(std::max(int((n + 1) * INHABITED_CHANCE), min), max);
+    double peak = logInhabitedChance(n, mode);
+
+    int first = mode, last = mode;
+    while (first > min && logInhabitedChance(n, first - 1) - peak > -40) first--;
+    while (last < max && logInhabitedChance(n, last + 1) - peak > -40) last++;
+
+    std::vector<double> chances;
+    double total = 0;
+
+    for (int k = first; k <= last; k++) {
+        chances.push_back(exp(logInhabitedChance(n, k) - peak));
+        total += chances.back();
+    }
 
-            daysLeft = months[month];
+    double target = random.uniform() * total;
+
+    for (int k = first; k <= last; k++) {
+        target -= chances[k - first];
+        if (target < 0) return k;
+    }
+
+    return last;
+}
+
+// The number of chunks to generate n planets in, at once
+static unsigned int generationChunks(unsigned int n) {
+    return n < GENERATION_PARALLEL_MIN_PLANETS ? 1 : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Splits [0, n) into count consecutive chunks, calling fn(chunk, first, last)
+// for each, on its own thread if there's more than one
+static void forEachChunk(unsigned int n, unsigned int count,
+                         const std::function<void(unsigned int, unsigned int, unsigned int)> &fn) {
+    std::vector<std::thread> workers;
+
+    for (unsigned int c = 1; c < count; c++) {
+        workers.emplace_back(fn, c, uint64_t(n) * c / count, uint64_t(n) * (c + 1) / count);
+    }
+
+    fn(0, 0, n / count);
+
+    for (auto &worker : workers) worker.join();
+}
+
+void Game::generatePlanets() {
+    unsigned int n = NUM_PLANETS;
+
+    planets.clear();
+    store.clear();
+    backgroundDirty = true;
+    edgesDirty = true;
+
+    // Choose how many planets are inhabited, and then which ones,
+    // by shuffling that many to the front. If most are inhabited,
+    // it's quicker to choose the ones which aren't.
+    Random random(seed, 0, InhabitedStream);
+    unsigned int inhabitedCount = randomInhabitedCount(random, n, MIN_REQ_INHABITED, MAX_REQ_INHABITED);
+
+    bool mostInhabited = inhabitedCount > n / 2;
+    unsigned int chosen = mostInhabited ? n - inhabitedCount : inhabitedCount;
+
+    std::vector<unsigned int> order(n);
+    std::vector<bool> inhabited(n, mostInhabited);
+
+    for (unsigned int i = 0; i < n; i++) order[i] = i;
+
+    for (unsigned int i = 0; i < chosen; i++) {
+        std::swap(order[i], order[i + random.below(n - i)]);
+        inhabited[order[i]] = !mostInhabited;
+    }
+
+    // Every planet has its own random numbers, so they can be
+    // generated in any order, in chunks on separate threads
+    store.resize(n);
+
+    unsigned int count = generationChunks(n);
+    std::vector<std::vector<Planet>> chunks(count);
+    std::vector<char> nameSlots(size_t(n) * NAME_SLOT);
+
+    forEachChunk(n, count, [&](unsigned int c, unsigned int first, unsigned int last) {
+        chunks[c].reserve(last - first);
+
+        for (unsigned int i = first; i < last; i++) {
+            Random planetRandom(seed, i, GenerationStream);
+            chunks[c].emplace_back(&store, i, inhabited[i], planetRandom);
+
+            Random nameRandom(seed, i, NameStream);
+            NameGenerator::randomName(nameRandom, &nameSlots[size_t(i) * NAME_SLOT]);
         }
+    });
+
+    planets.reserve(n);
+
+    for (auto &chunk : chunks) {
+        std::move(chunk.begin(), chunk.end(), std::back_inserter(planets));
+    }
+
+    // Names can clash, so they're made unique one after another
+    std::vector<const char*> planetNames(n), inhabitantNames(n);
+    names.add(nameSlots.data(), n, planetNames.data(), inhabitantNames.data());
 
-        date++;
-        daysLeft--;
+    for (unsigned int i = 0; i < n; i++) {
+        planets[i].name = planetNames[i];
+        planets[i].inhabitants = inhabitantNames[i];
     }
 
-    return std::make_tuple(date, month + 1, year);
+    // Each orbit is the last planet's diameter (and a gap) further
+    // out than the one before it, so the distances are a running sum
+    float distance = SUN_RADIUS + N(50);
+
+    for (unsigned int i = 0; i < n; i++) {
+        store.distanceFromSun[i] = distance;
+        distance += store.pixelRadius[i] * 2 + N(20);
+    }
+
+    forEachChunk(n, count, [&](unsigned int c, unsigned int first, unsigned int last) {
+        for (unsigned int i = first; i < last; i++) planets[i].placeInOrbit(store.distanceFromSun[i]);
+    });
 }
 
-std::vector<Planet*> Game::generatePlanets() {
-    int numberInhabited = 0;
+bool Game::save(const std::string &path) {
+    unsigned int n = planets.size();
+
+    SnapshotHeader header = {};
+    header.planets = n;
+    header.ships = ships.size();
+    header.timeWarp = timeWarp;
+    header.widthRatio = WIDTH_RATIO;
+    header.systemX = SYSTEM_X;
+    header.systemY = SYSTEM_Y;
+    header.seed = seed;
+    header.elapsed = elapsed;
+    header.tick = store.tick;
+
+    // Planets and ships are saved with indices in place of pointers
+    const std::vector<char> &arena = names.getArena();
+    std::vector<SnapshotPlanet> savedPlanets(n);
+
+    for (unsigned int i = 0; i < n; i++) {
+        Planet &planet = planets[i];
+
+        savedPlanets[i] = {planet.earthLikeness, planet.radius, planet.mass, planet.gravity,
+                           planet.colour.toInteger(),
+                           uint32_t(planet.name - arena.data()), uint32_t(planet.inhabitants - arena.data())};
+    }
+
+    std::vector<SnapshotShip> savedShips;
+
+    for (auto &ship : ships) {
+        SnapshotShip saved = {ship.getSender()->index, ship.getDestination()->index,
+                              ship.getOrigin().x, ship.getOrigin().y,
+                              ship.getIntercept().x, ship.getIntercept().y,
+                              ship.getDeparture(), ship.arrivalTime, {}};
+
+        memcpy(saved.resources, ship.resources.store, sizeof(saved.resources));
+        savedShips.push_back(saved);
+    }
+
+    // Everything else is written straight from where it is
+    SnapshotWriter writer(header);
+
+    writer.add(AngleSection, store.angle.data(), n * sizeof(float));
+    writer.add(SpeedSection, store.speed.data(), n * sizeof(float));
+    writer.add(AngularSpeedSection, store.angularSpeed.data(), n * sizeof(float));
+    writer.add(DistanceSection, store.distanceFromSun.data(), n * sizeof(float));
+    writer.add(CapacitySection, store.capacity.data(), n * sizeof(float));
+    writer.add(BiodiversitySection, store.biodiversity.data(), n * sizeof(float));
+    writer.add(PixelRadiusSection, store.pixelRadius.data(), n * sizeof(float));
+    writer.add(XSection, store.x.data(), n * sizeof(float));
+    writer.add(YSection, store.y.data(), n * sizeof(float));
+
+    for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+        writer.add(ResourcesSection + type, store.resources[type].data(), n * sizeof(int64_t));
+    }
+
+    writer.add(PlanetsSection, savedPlanets.data(), n * sizeof(SnapshotPlanet));
+    writer.add(NamesSection, arena.data(), arena.size());
+    writer.add(RelationshipsSection, relationships->edges(), PlanetRelationships::edgeCount(n) * sizeof(float));
 
-    // Continuously generate new sets of planets until enough are inhabited.
-    while (numberInhabited < MIN_REQ_INHABITED || numberInhabited > MAX_REQ_INHABITED) {
-        planets.clear();
+    const std::vector<float> &reputations = dynamics.getReputations();
+    writer.add(ReputationsSection, reputations.data(), reputations.size() * sizeof(float));
 
-        float dist = SUN_RADIUS + N(50);
+    writer.add(ShipsSection, savedShips.data(), savedShips.size() * sizeof(SnapshotShip));
 
-        for (int i = 0; i < NUM_PLANETS; i++) {
-            Planet planet(dist);
-            planets.push_back(planet);
+    return writer.write(path);
+}
+
+Game *Game::load(const std::string &path, bool headless) {
+    std::shared_ptr<Snapshot> snapshot = Snapshot::open(path);
+    if (snapshot == nullptr) return nullptr;
+
+    // Check every section is the size the counts say it should be,
+    // and that every name and planet index is in range
+    const SnapshotHeader &header = snapshot->header();
+    unsigned int n = header.planets;
+    bool valid = n > 0;
+
+    for (unsigned int id = AngleSection; id <= YSection; id++) {
+        valid = valid && snapshot->section<float>(id, n) != nullptr;
+    }
+
+    for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+        valid = valid && snapshot->section<int64_t>(ResourcesSection + type, n) != nullptr;
+    }
+
+    uint64_t namesSize = header.sizes[NamesSection];
+    const char *savedNames = snapshot->section<char>(NamesSection, namesSize);
+    const SnapshotPlanet *savedPlanets = snapshot->section<SnapshotPlanet>(PlanetsSection, n);
+    const SnapshotShip *savedShips = snapshot->section<SnapshotShip>(ShipsSection, header.ships);
+    uint64_t reputations = header.sizes[ReputationsSection] / sizeof(float);
+
+    valid = valid && savedPlanets != nullptr && savedShips != nullptr
+            && namesSize > 0 && savedNames[namesSize - 1] == '\0'
+            && snapshot->section<float>(RelationshipsSection, PlanetRelationships::edgeCount(n)) != nullptr
+            && (reputations == 0 || reputations == n)
+            && snapshot->section<float>(ReputationsSection, reputations) != nullptr;
+
+    for (unsigned int i = 0; valid && i < n; i++) {
+        valid = savedPlanets[i].name < namesSize && savedPlanets[i].inhabitants < namesSize;
+    }
+
+    for (unsigned int i = 0; valid && i < header.ships; i++) {
+        valid = savedShips[i].sender < n && savedShips[i].destination < n;
+    }
 
-            dist += planet.getPixelRadius() * 2 + N(20);
+    if (!valid) {
+        std::cerr << "Couldn't load " << path << ": it's been corrupted" << std::endl;
+        return nullptr;
+    }
+
+    return new Game(snapshot, headless);
+}
+
+Game::Game(const std::shared_ptr<Snapshot> &snapshot, bool headless):
+        headless(headless), sidebar(nullptr), dragging(false) {
+
+    const SnapshotHeader &header = snapshot->header();
+    unsigned int n = header.planets;
+
+    seed = header.seed;
+    elapsed = header.elapsed;
+    timeWarp = header.timeWarp;
+
+    store.seed = header.seed;
+    store.tick = header.tick;
+    store.resize(n);
+
+    // The per-planet arrays are small, so they're copied into the
+    // store. Only the pages they're on are read from the file.
+    std::vector<float> *arrays[] = {
+            &store.angle, &store.speed, &store.angularSpeed, &store.distanceFromSun,
+            &store.capacity, &store.biodiversity, &store.pixelRadius, &store.x, &store.y
+    };
+
+    for (unsigned int id = AngleSection; id <= YSection; id++) {
+        const float *saved = snapshot->section<float>(id, n);
+        std::copy(saved, saved + n, arrays[id - AngleSection]->begin());
+    }
+
+    for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+        const int64_t *saved = snapshot->section<int64_t>(ResourcesSection + type, n);
+        std::copy(saved, saved + n, store.resources[type].begin());
+    }
+
+    // Sizes and positions are in pixels, so they're scaled to fit
+    // this display, around its centre, if it's not the one they
+    // were saved on. Orbits still take the same time.
+    float scale = WIDTH_RATIO / header.widthRatio;
+    sf::Vector2f savedCentre(header.systemX, header.systemY);
+
+    auto rescale = [&](sf::Vector2f point) { return (point - savedCentre) * scale + SYSTEM_CENTER; };
+
+    if (scale != 1 || savedCentre != SYSTEM_CENTER) {
+        for (unsigned int i = 0; i < n; i++) {
+            store.distanceFromSun[i] *= scale;
+            store.pixelRadius[i] *= scale;
+
+            sf::Vector2f position = rescale(sf::Vector2f(store.x[i], store.y[i]));
+            store.x[i] = position.x;
+            store.y[i] = position.y;
         }
+    }
+
+    uint64_t namesSize = header.sizes[NamesSection];
+    const char *arena = names.load(snapshot->section<char>(NamesSection, namesSize), namesSize);
+    const SnapshotPlanet *savedPlanets = snapshot->section<SnapshotPlanet>(PlanetsSection, n);
+
+    planets.reserve(n);
+
+    for (unsigned int i = 0; i < n; i++) {
+        const SnapshotPlanet &saved = savedPlanets[i];
+        Planet planet(&store, i);
+
+        planet.earthLikeness = saved.earthLikeness;
+        planet.radius = saved.radius;
+        planet.mass = saved.mass;
+        planet.gravity = saved.gravity;
+        planet.colour = sf::Color(saved.colour);
+        planet.name = arena + saved.name;
+        planet.inhabitants = arena + saved.inhabitants;
+
+        planets.push_back(planet);
+    }
+
+    // The graph is by far the biggest part of a snapshot, so
+    // it's used where it is, and paged in as it's touched
+    float *edges = snapshot->section<float>(RelationshipsSection, PlanetRelationships::edgeCount(n));
+    relationships = new PlanetRelationships(n, edges, snapshot);
+
+    uint64_t reputations = header.sizes[ReputationsSection] / sizeof(float);
+    dynamics.setReputations(snapshot->section<float>(ReputationsSection, reputations), reputations);
+
+    const SnapshotShip *savedShips = snapshot->section<SnapshotShip>(ShipsSection, header.ships);
 
-        numberInhabited = 0;
+    for (unsigned int i = 0; i < header.ships; i++) {
+        const SnapshotShip &saved = savedShips[i];
 
-        for (auto &planet : planets) {
-            if (planet.isInhabited()) numberInhabited++;
+        Resources cargo;
+        memcpy(cargo.store, saved.resources, sizeof(saved.resources));
+
+        Spaceship ship(&planets[saved.sender], &planets[saved.destination], cargo,
+                       rescale(sf::Vector2f(saved.originX, saved.originY)),
+                       rescale(sf::Vector2f(saved.interceptX, saved.interceptY)),
+                       saved.departure, saved.arrival);
+
+        arrivals.push({saved.arrival, ships.add(ship)});
+    }
+
+    setUpInterface();
+}
+
+uint64_t Game::checksum() {
+    // FNV-1a, a word at a time rather than a byte
+    uint64_t hash = 14695981039346656037ULL;
+
+    auto mix = [&](const void *data, size_t size) {
+        const unsigned char *bytes = static_cast<const unsigned char*>(data);
+        size_t i = 0;
+
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            memcpy(&word, bytes + i, 8);
+            hash = (hash ^ word) * 1099511628211ULL;
         }
+
+        for (; i < size; i++) hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    };
+
+    unsigned int n = store.size();
+
+    mix(&store.tick, sizeof(store.tick));
+    mix(&elapsed, sizeof(elapsed));
+    mix(store.angle.data(), n * sizeof(float));
+    mix(store.x.data(), n * sizeof(float));
+    mix(store.y.data(), n * sizeof(float));
+
+    for (auto &counts : store.resources) mix(counts.data(), n * sizeof(int64_t));
+
+    mix(relationships->edges(), PlanetRelationships::edgeCount(n) * sizeof(float));
+
+    const std::vector<float> &reputations = dynamics.getReputations();
+    mix(reputations.data(), reputations.size() * sizeof(float));
+
+    for (auto &ship : ships) {
+        uint32_t ends[2] = {ship.getSender()->index, ship.getDestination()->index};
+
+        mix(ends, sizeof(ends));
+        mix(&ship.arrivalTime, sizeof(ship.arrivalTime));
+        mix(ship.resources.store, sizeof(ship.resources.store));
     }
 
-    std::vector<Planet*> pptrs;
-    for (auto &planet : planets) pptrs.push_back(&planet);
+    return hash;
+}
+
+bool Game::replay(const JournalRecord &record) {
+    switch (record.action) {
+        case LaunchAction: {
+            if (record.sender >= planets.size() || record.destination >= planets.size()) return false;
 
-    return pptrs;
+            Resources resources;
+            memcpy(resources.store, record.resources, sizeof(resources.store));
+
+            launchShip(&planets[record.sender], &planets[record.destination], resources);
+            return true;
+        }
+
+        case ChecksumAction:
+            return record.checksum == checksum();
+
+        default:
+            return false;
+    }
 }
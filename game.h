@@ -6,13 +6,23 @@
 #define SOLAR_SYSTEM_GAME_H
 
 #include <SFML/Graphics.hpp>
+#include <memory>
+#include <queue>
+#include <string>
 #include <vector>
 
 #include "scene.h"
 #include "planet.h"
+#include "planet_store.h"
+#include "planet_visual.h"
 #include "spaceship.h"
+#include "ship_pool.h"
+#include "spatial_grid.h"
 #include "mainmenu.h"
+#include "name_generator.h"
+#include "journal.h"
 #include "sidebar.h"
+#include "snapshot.h"
 
 // Forward declare Spaceship and Sidebar, because
 // of a circular dependency
@@ -21,6 +31,7 @@ class Sidebar;
 class PlanetRelationships;
 
 #include "planet_relationships.h"
+#include "relationship_dynamics.h"
 
 /** class Game : public Scene
  *
@@ -30,14 +41,68 @@ class PlanetRelationships;
  */
 class Game : public Scene {
 
-    // The milliseconds elapsed since the game started
-    unsigned int elapsed = 0;
+    // Whether the game is running without a window. A
+    // headless game has no fonts, sidebar or shapes to render.
+    bool headless;
+
+    // The world seed, which everything random is derived from
+    uint64_t seed;
+
+    // The microseconds of game time elapsed since the game
+    // started. 64 bits lasts for over half a million years.
+    uint64_t elapsed = 0;
+
+    // How many times faster than real time the game runs, and
+    // the warped time (in seconds) still waiting to be ticked
+    int timeWarp = MIN_TIME_WARP;
+    float unticked = 0;
+
+    // The simulation state of the planets, which
+    // is updated every tick
+    PlanetStore store;
 
     // The generated planets
     std::vector<Planet> planets;
 
+    // Makes the planets' names, and holds them
+    NameGenerator names;
+
+    // The shapes used to draw each planet, in the same order
+    // as planets. Empty when headless.
+    std::vector<PlanetVisual> visuals;
+
+    // Buckets the planets by where they are on screen, for
+    // finding the one under the mouse. Unused when headless.
+    SpatialGrid planetGrid;
+
+    // A ship's predicted arrival, ordered soonest first in arrivals
+    struct ShipArrival {
+        uint64_t due;
+        ShipHandle ship;
+
+        bool operator>(const ShipArrival &other) const { return due > other.due; }
+    };
+
+    std::priority_queue<ShipArrival, std::vector<ShipArrival>, std::greater<ShipArrival>> arrivals;
+
     // The planet relationship graph
-    PlanetRelationships *relationships;
+    PlanetRelationships *relationships = nullptr;
+    RelationshipDynamics dynamics;
+
+    // Records the player's actions, so the game can be replayed.
+    // Only new games played in a window have one.
+    Journal *journal = nullptr;
+
+    // Every relationship edge being drawn, as quads, so
+    // they can all be drawn at once
+    sf::VertexArray edgeVertices;
+
+    // The tick and selection the edges were built for. The planets
+    // and relationships only change when a tick is stepped, so the
+    // edges are only rebuilt after one, or if they're marked dirty.
+    uint64_t edgesTick = 0;
+    Planet *edgesSelected = nullptr;
+    bool edgesDirty = true;
 
     // The selected planet. Used for dragging
     // from one planet to another
@@ -46,16 +111,27 @@ class Game : public Scene {
     // The sun's CircleShape instance
     sf::CircleShape sun;
 
-    // The current sidebar instance. Can be any
-    // subclass of Sidebar
+    // The sun and the orbits, drawn once and reused every frame
+    // until the planets or the window change
+    sf::RenderTexture background;
+    sf::Sprite backgroundSprite;
+    bool backgroundDirty = true;
+
+    // The current sidebar instance, which is one of the
+    // long-lived sidebars below
     Sidebar *sidebar;
+    PlanetInspector *inspector = nullptr;
+    ShipDesigner *designer = nullptr;
 
     // The line connected the sender to the destination
     // planet on planet drag operations
     sf::RectangleShape dragLine;
 
-    sf::Font font;
+    // The date and time warp, which are only formatted
+    // again when one of them changes
     sf::Text yearDisplay;
+    std::tuple<int, int, int> shownDate;
+    int shownWarp = 0;
 
     // Whether the player is dragging from a planet
     // at the moment
@@ -65,24 +141,87 @@ class Game : public Scene {
     void mouseDown(sf::Vector2f);
     void mouseUp(sf::Vector2f);
     void selectPlanet(Planet *);
+    Planet *planetAt(sf::Vector2f);
+    void setTimeWarp(int);
     void positionDragLine(sf::Window*);
+    void renderBackground(sf::RenderWindow*);
     void renderRelationships(sf::RenderWindow*);
-    std::vector<Planet*> generatePlanets();
+    void buildEdgeVertices();
+    void generatePlanets();
+
+    // Sets up everything needed to play the game
+    // in a window, once the simulation is ready
+    void setUpInterface();
+
+    // Restores the game from a snapshot whose sections are all
+    // the right size, which has been checked by load()
+    Game(const std::shared_ptr<Snapshot>&, bool headless);
 
 public:
-    // Initialises the game's properties.
+    // Initialises the game's properties from the world seed.
     // Ensures a valid amount of planets are generated.
-    Game();
+    explicit Game(uint64_t seed, bool headless = false);
+
+    // Frees the relationships, sidebars and journal, closing
+    // the journal and any snapshot the game was loaded from
+    ~Game() override;
+
+    Game(const Game&) = delete;
+    Game &operator=(const Game&) = delete;
+
+    // Loads a game saved with save(). Returns nullptr,
+    // after printing why, if it can't be loaded.
+    static Game *load(const std::string &path, bool headless = false);
+
+    // Saves the whole simulation, so it can be loaded again
+    // later. Returns false, after printing why, if it can't.
+    bool save(const std::string &path);
+
+    // Advances the simulation (planets, ships and relationships) by dt
+    // seconds, without touching anything visual.
+    void step(float dt);
+
+    // Jumps the simulation forward by duration seconds, much faster
+    // than stepping it. The planets move along closed forms, ships
+    // due to arrive in that time are delivered, and the relationships
+    // are updated once every FAST_FORWARD_STEP_S seconds.
+    void fastForward(double duration);
 
     Scene *update(float) override;
     void render(sf::RenderWindow*) override;
     Scene *handleEvent(sf::Event*) override;
     void removeSidebar();
 
+    // Launches a ship from the sender with the given resources,
+    // towards the destination. The ship uses up SHIP_METAL_USAGE
+    // metal, and isn't launched if the sender can't afford it all.
+    void launchShip(Planet *sender, Planet *destination, Resources);
+
+    // Hashes the whole simulation state, to tell whether
+    // two games have played out the same
+    uint64_t checksum();
+
+    // Applies a journal record, as of the record's tick. Returns
+    // false if it's a checksum which doesn't match, or is invalid.
+    bool replay(const JournalRecord&);
+
+    // The number of ticks simulated so far
+    uint64_t getTick() { return store.tick; }
+
+    // The microseconds of game time elapsed so far
+    uint64_t getElapsed() { return elapsed; }
+
+    // The simulation state, for inspecting it
+    const PlanetStore &getStore() const { return store; }
+    const PlanetRelationships &getRelationships() const { return *relationships; }
+
+    // Gets the (date, month, year) in constant time
     std::tuple<int, int, int> getDate();
 
+    uint64_t getSeed() { return seed; }
+
     // The spaceships currently flying around.
-    std::vector<Spaceship> ships;
+    ShipPool ships;
 };
 
 #endif //SOLAR_SYSTEM_GAME_H
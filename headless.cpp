@@ -0,0 +1,156 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include "config.h"
+#include "headless.h"
+#include "game.h"
+#include "journal.h"
+#include "planet_kernels.h"
+#include "random.h"
+#include "relationship_dynamics.h"
+
+// Runs the relationship dynamics for a made-up system of the given
+// size, with planets and weaponary scattered at random.
+static int benchmarkRelationships(const HeadlessOptions &options) {
+    unsigned int n = options.relationshipPlanets;
+    unsigned long long ticks = options.ticks > 0 ? options.ticks : 60ULL * 60 * TIMESCALE;
+
+    PlanetStore store;
+    PlanetRelationships relationships(n);
+    RelationshipDynamics dynamics;
+
+    for (unsigned int i = 0; i < n; i++) {
+        Random random(options.seed, i, GenerationStream);
+
+        store.add();
+        store.x[i] = random.range(0, WIDTH);
+        store.y[i] = random.range(0, HEIGHT);
+        store.resources[Weaponary][i] = random.below(MAX_WEAPONARY);
+
+        for (unsigned int j = i + 1; j < n; j++) {
+            relationships.row(i)[j - i - 1] = random.range(MIN_PLANET_REL, MAX_PLANET_REL);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned long long tick = 0; tick < ticks; tick++) {
+        dynamics.update(relationships, store, options.timestep);
+    }
+
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Updated the relationships between " << n << " planets for "
+              << ticks << " ticks in " << wall.count() << "s"
+              << " (" << (wall.count() > 0 ? ticks / wall.count() : 0) << " ticks/s)" << std::endl;
+
+    return 0;
+}
+
+// Replays a journalled game, as fast as possible, checking it
+// against every checksum in the journal along the way.
+int replayJournal(const std::string &path) {
+    JournalHeader header;
+    std::vector<JournalRecord> records;
+
+    if (!Journal::read(path, header, records)) return 1;
+
+    // The checksums only match on the kernels the game was
+    // played with, so a CPU without them can't check it
+    PlanetKernelLevel level = PlanetKernelLevel(header.kernelLevel);
+
+    if (!setPlanetKernelLevel(level)) {
+        std::cerr << "Couldn't replay " << path << ": it was played with "
+                  << planetKernelLevelName(level) << " kernels, which this CPU doesn't support" << std::endl;
+        return 1;
+    }
+
+    // Remake the world exactly as it was played
+    Scenario::current = header.scenario;
+    DisplayMetrics::resize(header.desktopWidth);
+
+    Game game(header.seed, true);
+
+    unsigned long long launches = 0, checksums = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto &record : records) {
+        while (game.getTick() < record.tick) game.step(TICK_LENGTH_S);
+
+        if (!game.replay(record)) {
+            std::cerr << "The replay diverged from the journal at tick " << record.tick << std::endl;
+            return 1;
+        }
+
+        if (record.action == LaunchAction) launches++;
+        if (record.action == ChecksumAction) checksums++;
+    }
+
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Replayed " << game.getTick() << " ticks and " << launches << " launches"
+              << " in " << wall.count() << "s using " << planetKernelsName() << " kernels"
+              << ", matching all " << checksums << " checksums" << std::endl;
+
+    return 0;
+}
+
+int runHeadless(const HeadlessOptions &options) {
+    // There's no desktop to measure, so use the virtual resolution
+    DisplayMetrics::init(true);
+
+    if (options.relationshipPlanets > 0) return benchmarkRelationships(options);
+    if (options.replayPath != nullptr) return replayJournal(options.replayPath);
+
+    std::unique_ptr<Game> game;
+
+    if (options.loadPath != nullptr) {
+        auto loadStart = std::chrono::steady_clock::now();
+
+        game.reset(Game::load(options.loadPath, true));
+        if (game == nullptr) return 1;
+
+        std::chrono::duration<double> loadWall = std::chrono::steady_clock::now() - loadStart;
+        std::cout << "Loaded " << options.loadPath << " in " << loadWall.count() << "s" << std::endl;
+    } else {
+        game.reset(new Game(options.seed, true));
+    }
+
+    if (options.years > 0) {
+        auto jumpStart = std::chrono::steady_clock::now();
+
+        // 1 game year = TIMESCALE real minutes
+        game->fastForward(options.years * TIMESCALE * 60);
+
+        std::chrono::duration<double> jumpWall = std::chrono::steady_clock::now() - jumpStart;
+        std::cout << "Fast forwarded " << options.years << " years in " << jumpWall.count() << "s" << std::endl;
+    }
+
+    unsigned long long ticks = options.ticks > 0 ? options.ticks : 60ULL * 60 * TIMESCALE;
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned long long tick = 0; tick < ticks; tick++) {
+        game->step(options.timestep);
+    }
+
+    std::chrono::duration<double> wall = std::chrono::steady_clock::now() - start;
+
+    int date, month, year;
+    std::tie(date, month, year) = game->getDate();
+
+    std::cout << "Simulated " << ticks << " ticks of " << options.timestep << "s"
+              << " in " << wall.count() << "s"
+              << " (" << (wall.count() > 0 ? ticks / wall.count() : 0) << " ticks/s)"
+              << " using " << planetKernelsName() << " kernels" << std::endl;
+    std::cout << "Reached " << date << "/" << month << "/" << year
+              << " in world " << game->getSeed() << std::endl;
+
+    if (options.savePath != nullptr && !game->save(options.savePath)) return 1;
+
+    return 0;
+}
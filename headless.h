@@ -0,0 +1,54 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_HEADLESS_H
+#define SOLAR_SYSTEM_HEADLESS_H
+
+#include <cstdint>
+#include <string>
+
+#include "config.h"
+
+/** HeadlessOptions
+ *
+ * Controls a headless run: how many fixed ticks to
+ * simulate, how long each tick is and the world seed.
+ * It can also jump ahead before ticking, or benchmark
+ * the relationship dynamics on their own.
+ */
+struct HeadlessOptions {
+    // 0 is one game year of ticks, which depends on the scenario
+    unsigned long long ticks = 0;
+    float timestep = TICK_LENGTH_S;
+    uint64_t seed = 0;
+
+    // The number of game years to fast forward by first
+    double years = 0;
+
+    // If set, only the relationship dynamics are run, for
+    // this many made-up planets, instead of a whole game
+    unsigned int relationshipPlanets = 0;
+
+    // If set, the game is loaded from this snapshot instead of
+    // being generated, and/or saved to this one at the end
+    const char *loadPath = nullptr;
+    const char *savePath = nullptr;
+
+    // If set, the game recorded in this journal is replayed
+    // instead, checking it plays out the same
+    const char *replayPath = nullptr;
+};
+
+// Simulates a game without a window, stepping it at a fixed
+// timestep as fast as possible, then reports the throughput.
+// Returns the process exit code.
+int runHeadless(const HeadlessOptions&);
+
+// Replays the game recorded in a journal, in the same world and
+// on the same kernels, checking it against every checksum in the
+// journal. Returns the process exit code: 0 if it all matched, or
+// 1 if it can't be replayed here or it diverged.
+int replayJournal(const std::string &path);
+
+#endif //SOLAR_SYSTEM_HEADLESS_H
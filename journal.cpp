@@ -0,0 +1,135 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include "journal.h"
+
+static const char journalMagic[8] = {'S', 'O', 'L', 'A', 'R', 'J', 'N', 'L'};
+
+// The size of a header on disk: the magic, version and size, then the
+// kernel level, desktop width, seed and each setting of the scenario
+#define JOURNAL_HEADER_SIZE (8 + 4 * 4 + 8 + 5 * 4 + 2 * 4 + 8 + 4)
+
+static_assert(sizeof(JournalRecord) == 8 * 4 + 8 * NUM_RESOURCE_SLOTS,
+              "journal records must have the same layout everywhere");
+
+// Appends a fixed width value to a header
+template <typename T>
+static void put(std::vector<char> &out, T value) {
+    const char *bytes = reinterpret_cast<const char*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+// Reads a fixed width value from a header, moving past it
+template <typename T>
+static T take(const char *&in) {
+    T value;
+    memcpy(&value, in, sizeof(T));
+    in += sizeof(T);
+    return value;
+}
+
+static std::vector<char> encodeHeader(const JournalHeader &header) {
+    std::vector<char> out(journalMagic, journalMagic + sizeof(journalMagic));
+    const Scenario &scenario = header.scenario;
+
+    put<uint32_t>(out, JOURNAL_VERSION);
+    put<uint32_t>(out, JOURNAL_HEADER_SIZE);
+    put<uint32_t>(out, header.kernelLevel);
+    put<float>(out, header.desktopWidth);
+    put<uint64_t>(out, header.seed);
+
+    put<int32_t>(out, scenario.numPlanets);
+    put<int32_t>(out, scenario.minInhabited);
+    put<int32_t>(out, scenario.maxInhabited);
+    put<int32_t>(out, scenario.minPopulation);
+    put<int32_t>(out, scenario.maxPopulation);
+    put<float>(out, scenario.minPlanetSpeed);
+    put<float>(out, scenario.maxPlanetSpeed);
+    put<int64_t>(out, scenario.maxCargoPerResource);
+    put<int32_t>(out, scenario.timescale);
+
+    return out;
+}
+
+// Reads the fields after the magic, version and size
+static void decodeHeader(const char *in, JournalHeader &header) {
+    Scenario &scenario = header.scenario;
+
+    header.kernelLevel = take<uint32_t>(in);
+    header.desktopWidth = take<float>(in);
+    header.seed = take<uint64_t>(in);
+
+    scenario.numPlanets = take<int32_t>(in);
+    scenario.minInhabited = take<int32_t>(in);
+    scenario.maxInhabited = take<int32_t>(in);
+    scenario.minPopulation = take<int32_t>(in);
+    scenario.maxPopulation = take<int32_t>(in);
+    scenario.minPlanetSpeed = take<float>(in);
+    scenario.maxPlanetSpeed = take<float>(in);
+    scenario.maxCargoPerResource = take<int64_t>(in);
+    scenario.timescale = take<int32_t>(in);
+}
+
+Journal::Journal(const std::string &path, const JournalHeader &header) {
+    file = fopen(path.c_str(), "wb");
+
+    if (file == nullptr) {
+        std::cerr << "Couldn't start the journal " << path << ": " << strerror(errno) << std::endl;
+        return;
+    }
+
+    std::vector<char> start = encodeHeader(header);
+
+    fwrite(start.data(), start.size(), 1, file);
+    fflush(file);
+}
+
+Journal::~Journal() {
+    if (file != nullptr) fclose(file);
+}
+
+void Journal::record(const JournalRecord &record) {
+    if (file == nullptr) return;
+
+    fwrite(&record, sizeof(record), 1, file);
+    fflush(file);
+}
+
+bool Journal::read(const std::string &path, JournalHeader &header, std::vector<JournalRecord> &records) {
+    FILE *file = fopen(path.c_str(), "rb");
+
+    if (file == nullptr) {
+        std::cerr << "Couldn't read the journal " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    char start[JOURNAL_HEADER_SIZE];
+    const char *fields = start + sizeof(journalMagic);
+
+    bool valid = fread(start, sizeof(start), 1, file) == 1
+                 && memcmp(start, journalMagic, sizeof(journalMagic)) == 0;
+
+    if (!valid) {
+        std::cerr << "Couldn't read the journal " << path << ": it isn't a journal" << std::endl;
+    } else if (take<uint32_t>(fields) != JOURNAL_VERSION || take<uint32_t>(fields) != JOURNAL_HEADER_SIZE) {
+        std::cerr << "Couldn't read the journal " << path << ": it's from a different version of the game" << std::endl;
+        valid = false;
+    } else {
+        decodeHeader(fields, header);
+    }
+
+    JournalRecord record;
+    records.clear();
+
+    while (valid && fread(&record, sizeof(record), 1, file) == 1) {
+        records.push_back(record);
+    }
+
+    fclose(file);
+    return valid;
+}
@@ -0,0 +1,96 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_JOURNAL_H
+#define SOLAR_SYSTEM_JOURNAL_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "resource.h"
+#include "scenario.h"
+
+// Bumped whenever the layout of a journal changes
+#define JOURNAL_VERSION 3
+
+/** JournalAction
+ *
+ * The kinds of record in a journal. Launches are the only
+ * player actions which change the simulation; checksums are
+ * written every so often, to check a replay against.
+ */
+enum JournalAction : uint32_t {
+    LaunchAction = 1,
+    ChecksumAction = 2
+};
+
+/** struct JournalHeader
+ *
+ * The start of every journal: everything the world is made
+ * from, and how it was simulated, so it can be made again
+ * exactly. It's written field by field as fixed width values,
+ * so its layout doesn't depend on the platform that wrote it.
+ */
+struct JournalHeader {
+    // The PlanetKernelLevel the game ran on. The levels round
+    // differently, so it's replayed on the same one.
+    uint32_t kernelLevel;
+
+    // The desktop width the game was played at, since
+    // the simulation is in (scaled) pixels
+    float desktopWidth;
+
+    uint64_t seed;
+    Scenario scenario;
+};
+
+/** struct JournalRecord
+ *
+ * Something which happened just before the given tick:
+ * either a launch from sender to destination, or the
+ * checksum of the simulation as of that tick.
+ */
+struct JournalRecord {
+    uint64_t tick;
+    uint32_t action;
+    uint32_t sender, destination;
+
+    // Keeps the checksum 8 byte aligned, even where the
+    // compiler would only align it to 4
+    uint32_t padding;
+
+    uint64_t checksum;
+    int64_t resources[NUM_RESOURCE_SLOTS];
+};
+
+/** class Journal
+ *
+ * An append-only record of a game, which can be replayed
+ * headless to reproduce it. Every record is flushed as it's
+ * written, so a crash loses nothing.
+ */
+class Journal {
+    FILE *file;
+
+public:
+    // Starts a new journal at the given path, replacing any
+    // journal there. If it can't be written, nothing is recorded.
+    Journal(const std::string &path, const JournalHeader&);
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal &operator=(const Journal&) = delete;
+
+    // Appends a record
+    void record(const JournalRecord&);
+
+    // Reads a whole journal. Returns false, after printing why,
+    // if it can't be read. A record cut short at the end (by a
+    // crash) is ignored.
+    static bool read(const std::string &path, JournalHeader&, std::vector<JournalRecord>&);
+};
+
+#endif //SOLAR_SYSTEM_JOURNAL_H
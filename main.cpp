@@ -1,8 +1,15 @@
 #include <SFML/Graphics.hpp>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
 
 #include "config.h"
 #include "scene.h"
 #include "mainmenu.h"
+#include "assets.h"
+#include "headless.h"
 
 // The current scene, e.g. main menu or game
 Scene *scene;
@@ -10,9 +17,77 @@ Scene *scene;
 // Used to calculate delta time
 sf::Clock deltaClock;
 
-int main() {
-    // Seed random number generator based on system time
-    srand(time(nullptr));
+int main(int argc, char **argv) {
+    // Parse the command line. --headless runs the simulation
+    // without a window, for --ticks ticks of --timestep seconds,
+    // in the world generated from --seed (or the system time.)
+    // --years first fast forwards by that many game years.
+    // --relationships benchmarks just the relationship dynamics,
+    // between that many planets. --load starts from a saved game
+    // instead, and --save saves the game at the end. --replay
+    // replays the game recorded in a journal. Either way, --scenario reads the
+    // world's settings from a file, then each --set key=value
+    // overrides one of them.
+    bool headless = false;
+    HeadlessOptions options;
+    options.seed = time(nullptr);
+
+    const char *scenarioPath = nullptr;
+    std::vector<std::string> overrides;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            options.ticks = strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--timestep") == 0 && hasValue) {
+            options.timestep = strtof(argv[++i], nullptr);
+        } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--years") == 0 && hasValue) {
+            options.years = strtod(argv[++i], nullptr);
+        } else if (strcmp(argv[i], "--relationships") == 0 && hasValue) {
+            options.relationshipPlanets = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--load") == 0 && hasValue) {
+            options.loadPath = argv[++i];
+        } else if (strcmp(argv[i], "--save") == 0 && hasValue) {
+            options.savePath = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+            options.replayPath = argv[++i];
+        } else if (strcmp(argv[i], "--scenario") == 0 && hasValue) {
+            scenarioPath = argv[++i];
+        } else if (strcmp(argv[i], "--set") == 0 && hasValue) {
+            overrides.push_back(argv[++i]);
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--headless [--ticks n] [--timestep seconds] [--seed n] [--years n] [--relationships n] [--load file] [--save file] [--replay file]]"
+                      << " [--scenario file] [--set key=value ...]" << std::endl;
+            return 1;
+        }
+    }
+
+    // The overrides always win, wherever they are in the command line
+    if (scenarioPath != nullptr && !Scenario::current.load(scenarioPath)) return 1;
+
+    for (auto &setting : overrides) {
+        size_t equals = setting.find('=');
+
+        if (equals == std::string::npos || !Scenario::current.set(setting.substr(0, equals), setting.substr(equals + 1))) {
+            std::cerr << "Invalid setting \"" << setting << "\"" << std::endl;
+            return 1;
+        }
+    }
+
+    if (!Scenario::current.validate()) return 1;
+
+    if (headless) return runHeadless(options);
+
+    // Measure the desktop once, for all the sizing macros
+    DisplayMetrics::init(false);
+
+    // Read all the fonts up front, rather than mid-game
+    Assets::preload();
 
     // Enable antialasing at level 8
     // Maybe will be in settings later
@@ -49,18 +124,26 @@ int main() {
             Scene *next = scene->handleEvent(&event);
 
             // If the scene returned a scene change, change to it
-            if (next != nullptr) scene = next;
+            if (next != nullptr && next != scene) {
+                delete scene;
+                scene = next;
+            }
         }
 
         // Update the scene with the calculated delta time
         Scene *next = scene->update(dt);
 
         // If the scene returned a scene change, change to it
-        if (next != nullptr) scene = next;
+        if (next != nullptr && next != scene) {
+            delete scene;
+            scene = next;
+        }
 
         // Clear the window and render the scene
         window.clear(sf::Color(CLEAR_COLOUR));
         scene->render(&window);
         window.display();
     }
+
+    delete scene;
 }
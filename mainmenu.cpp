@@ -2,16 +2,15 @@
 // Created by Zac G on 08/10/2017.
 //
 
+#include <ctime>
+
+#include "assets.h"
 #include "mainmenu.h"
 
 MainMenu::MainMenu() {
-    // Load the required fonts
-    font.loadFromFile("../assets/fonts/EspressoDolce.ttf");
-    labelFont.loadFromFile("../assets/fonts/Cabin-Bold.ttf");
-
     // Setup the main title, positioned in the center horizontally and
     // slightly down from the top.
-    titleText.setFont(font);
+    titleText.setFont(Assets::font(TITLE_FONT));
     titleText.setString("Solar System");
     titleText.setCharacterSize(150);
     titleText.setFillColor(sf::Color::White);
@@ -41,8 +40,9 @@ Scene *MainMenu::handleEvent(sf::Event *event) {
     if (event->type == sf::Event::MouseButtonReleased) {
         sf::Vector2f pos(event->mouseButton.x, event->mouseButton.y);
 
-        // If the play button is clicked, go to the Game scene
-        if (isInsidePlayButtonArea(pos)) return new Game();
+        // If the play button is clicked, go to the Game scene,
+        // with a new world seed, based on the system time
+        if (isInsidePlayButtonArea(pos)) return new Game(time(nullptr));
     } else if (event->type == sf::Event::MouseMoved) {
         sf::Vector2f pos(event->mouseMove.x, event->mouseMove.y);
         // Toggle play button hover effect
@@ -81,7 +81,7 @@ void MainMenu::makeButton(
     planet->setPosition(orbit->getPosition() + ppos);
     planet->setFillColor(sf::Color(BRIGHT_FG));
 
-    text->setFont(labelFont);
+    text->setFont(Assets::font(HEADER_FONT));
     text->setString(label);
     text->setCharacterSize(radius / 2);
     sf::FloatRect textBounds = text->getLocalBounds();
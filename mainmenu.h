@@ -14,7 +14,6 @@
  * a title and a play button.
  */
 class MainMenu : public Scene {
-    sf::Font font, labelFont;
     sf::Text titleText, playLabel;
     sf::CircleShape playOrbit, playButton;
 
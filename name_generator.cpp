@@ -0,0 +1,188 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "config.h"
+#include "name_generator.h"
+#include "name_tables.h"
+
+// Names shorter than this are generated again
+#define MIN_NAME_LETTERS 3
+
+// FNV-1a, over a null terminated string
+static uint32_t hashName(const char *name) {
+    uint32_t hash = 2166136261u;
+
+    for (; *name != '\0'; name++) {
+        hash = (hash ^ uint8_t(*name)) * 16777619u;
+    }
+
+    return hash;
+}
+
+unsigned int NameGenerator::randomName(Random &random, char *out) {
+    unsigned int length = 0;
+
+    while (length < MIN_NAME_LETTERS) {
+        // Both letters before the start of a name are 0
+        unsigned int a = 0, b = 0;
+        length = 0;
+
+        for (;;) {
+            unsigned int state = a * NAME_ALPHABET + b;
+            unsigned int next = nameStateStarts[state];
+            unsigned int last = nameStateStarts[state + 1] - 1;
+
+            // Pick the next letter in proportion to its weight
+            uint32_t pick = random.below(nameNextWeights[last]);
+            while (nameNextWeights[next] <= pick) next++;
+
+            char letter = nameNextLetters[next];
+            if (letter == '.') break;
+
+            // Too long, so start again
+            if (length == MAX_NAME_LETTERS) {
+                length = 0;
+                break;
+            }
+
+            out[length++] = letter;
+            a = b;
+            b = unsigned(letter - 'a' + 1);
+        }
+    }
+
+    out[0] -= 32;
+    out[length] = '\0';
+
+    return length;
+}
+
+unsigned int NameGenerator::inhabitantName(const char *name, unsigned int length, char *out) {
+    // Any number added to the name isn't part of it
+    const char *space = static_cast<const char*>(memchr(name, ' ', length));
+    if (space != nullptr) length = unsigned(space - name);
+
+    memcpy(out, name, length);
+
+    char last = name[length - 1];
+
+    if (last == 'a') {
+        // Names ending in 'a' just add 'ns'
+        // e.g. Titania -> Titanians
+        memcpy(out + length, "ns", 3);
+        return length + 2;
+    }
+
+    // Replace a trailing 's' with 't', e.g. Mars -> Martians,
+    // and drop any other trailing vowel, e.g. Rhee -> Rheians
+    if (last == 's') {
+        out[length - 1] = 't';
+    } else if (last == 'e' || last == 'i' || last == 'o' || last == 'u' || last == 'y') {
+        length--;
+    }
+
+    memcpy(out + length, "ians", 5);
+    return length + 4;
+}
+
+// A bucket of the set of taken names, holding a name as 1 + its slot
+// (or 0 if it's empty,) its hash, so most other names can be told
+// apart without comparing them, and how many numbered copies of it
+// there are
+struct TakenName {
+    uint32_t slot;
+    uint32_t hash;
+    uint32_t copies;
+};
+
+// Finds the bucket of the name in the given slot, which has the given
+// hash, adding it to the open-addressed set of taken names if it isn't
+// there. Returns whether it was added.
+static bool take(std::vector<TakenName> &taken, const char *slots, uint32_t slot, uint32_t hash, size_t &bucket) {
+    const char *name = slots + size_t(slot) * NAME_SLOT;
+    size_t mask = taken.size() - 1;
+
+    for (bucket = hash & mask;; bucket = (bucket + 1) & mask) {
+        TakenName &entry = taken[bucket];
+
+        if (entry.slot == 0) {
+            entry = {slot + 1, hash, 0};
+            return true;
+        }
+
+        if (entry.hash == hash && strcmp(slots + size_t(entry.slot - 1) * NAME_SLOT, name) == 0) return false;
+    }
+}
+
+void NameGenerator::add(char *slots, unsigned int n, const char **names, const char **inhabitants) {
+    std::vector<uint32_t> hashes(n);
+    for (unsigned int i = 0; i < n; i++) hashes[i] = hashName(slots + size_t(i) * NAME_SLOT);
+
+    // Equal names have equal hashes, so the names can be split
+    // by hash into shards, which are made unique independently
+    unsigned int shards = n < GENERATION_PARALLEL_MIN_PLANETS ? 1 : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> sizes(shards, 0);
+
+    auto makeUnique = [&](unsigned int shard) {
+        // At least twice as many buckets as names keeps the probing short
+        size_t buckets = 1;
+        while (buckets < size_t(n) * 2 / shards) buckets *= 2;
+
+        std::vector<TakenName> taken(buckets, TakenName{0, 0, 0});
+        char inhabitantsName[NAME_SLOT + 4];
+
+        // Names are taken in planet order, so the earlier of two
+        // planets which drew the same name always keeps it
+        for (unsigned int i = 0; i < n; i++) {
+            if ((uint64_t(hashes[i]) * shards) >> 32 != shard) continue;
+
+            char *slot = slots + size_t(i) * NAME_SLOT;
+            unsigned int length = unsigned(strlen(slot));
+            size_t bucket;
+
+            // Numbered names never go in the set, and each name's
+            // copies are counted, so a numbered name is always unique
+            if (!take(taken, slots, i, hashes[i], bucket)) {
+                snprintf(slot + length, NAME_SLOT - length, " %u", ++taken[bucket].copies + 1);
+                length = unsigned(strlen(slot));
+            }
+
+            sizes[shard] += length + 1 + inhabitantName(slot, length, inhabitantsName) + 1;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned int shard = 1; shard < shards; shard++) workers.emplace_back(makeUnique, shard);
+
+    makeUnique(0);
+    for (auto &worker : workers) worker.join();
+
+    size_t size = 0;
+    for (size_t shardSize : sizes) size += shardSize;
+
+    arena.assign(size, '\0');
+    char *next = arena.data();
+
+    for (unsigned int i = 0; i < n; i++) {
+        const char *slot = slots + size_t(i) * NAME_SLOT;
+        unsigned int length = unsigned(strlen(slot));
+
+        memcpy(next, slot, length + 1);
+        names[i] = next;
+        next += length + 1;
+
+        inhabitants[i] = next;
+        next += inhabitantName(slot, length, next) + 1;
+    }
+}
+
+const char *NameGenerator::load(const char *saved, size_t size) {
+    arena.assign(saved, saved + size);
+    return arena.data();
+}
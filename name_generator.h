@@ -0,0 +1,60 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_NAME_GENERATOR_H
+#define SOLAR_SYSTEM_NAME_GENERATOR_H
+
+#include <cstdint>
+#include <vector>
+
+#include "random.h"
+
+// The most letters a generated name can have, before any
+// number added to keep it unique
+#define MAX_NAME_LETTERS 10
+
+// The room each name takes up while the names are being
+// generated, including its null terminator. It's enough for
+// the letters, a space and a seven digit number.
+#define NAME_SLOT 20
+
+/** class NameGenerator
+ *
+ * Generates planet names from a Markov chain over letters,
+ * whose tables are in name_tables.h, and makes sure no two
+ * planets share one. The names, and the names of their
+ * inhabitants, are kept together in one arena, so a planet
+ * only needs to point into it.
+ */
+class NameGenerator {
+    // Every name and the name of its inhabitants, each null
+    // terminated. It isn't resized once the names are made,
+    // so pointers into it stay valid until the next batch.
+    std::vector<char> arena;
+
+public:
+    // Writes a random name from the given random numbers into out,
+    // which must have room for NAME_SLOT characters. Returns its length.
+    static unsigned int randomName(Random&, char *out);
+
+    // Writes the name of the inhabitants of the named planet into out,
+    // which must have room for NAME_SLOT + 4 characters. Returns its length.
+    static unsigned int inhabitantName(const char *name, unsigned int length, char *out);
+
+    // Makes the names of n planets permanent. Each has already been
+    // written into its own NAME_SLOT of slots. Any name which was
+    // already taken, by an earlier planet, is numbered (e.g. Vega 2.)
+    // The names and inhabitants' names are then copied into the
+    // arena, which names and inhabitants point into.
+    void add(char *slots, unsigned int n, const char **names, const char **inhabitants);
+
+    // Gets the arena, e.g. to save it
+    const std::vector<char> &getArena() const { return arena; }
+
+    // Replaces the arena with a copy of one saved before,
+    // returning where the copy starts
+    const char *load(const char *saved, size_t size);
+};
+
+#endif //SOLAR_SYSTEM_NAME_GENERATOR_H
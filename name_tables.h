@@ -0,0 +1,199 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_NAME_TABLES_H
+#define SOLAR_SYSTEM_NAME_TABLES_H
+
+#include <cstdint>
+
+// The transition tables of the Markov chain which planet names are
+// generated from. They were counted from 494 names of real planets,
+// moons and stars, and of places from myth and fiction.
+//
+// Letters are numbered from 1 (a) to 26 (z), with 0 marking either
+// end of a name. The chain's state is the last two letters, a and b,
+// and the possible next letters for state (a * 27 + b) are those from
+// nameStateStarts[state] up to nameStateStarts[state + 1].
+
+#define NAME_ALPHABET 27
+
+const uint16_t nameStateStarts[NAME_ALPHABET * NAME_ALPHABET + 1] = {
+        0, 25, 41, 47, 55, 63, 74, 78, 83, 88, 93, 96, 102, 107, 114, 119,
+        126, 136, 138, 145, 157, 165, 170, 174, 176, 176, 179, 182, 182, 184, 189, 195,
+        203, 205, 209, 215, 219, 227, 228, 233, 255, 260, 272, 275, 281, 283, 299, 312,
+        322, 328, 330, 331, 332, 333, 338, 338, 346, 347, 347, 347, 353, 353, 353, 354,
+        358, 358, 358, 360, 360, 360, 365, 365, 365, 367, 368, 368, 370, 370, 370, 370,
+        373, 373, 373, 383, 383, 384, 385, 390, 390, 390, 397, 400, 400, 401, 402, 402,
+        402, 407, 407, 407, 410, 410, 413, 416, 416, 416, 416, 418, 418, 418, 426, 426,
+        426, 426, 434, 435, 436, 439, 444, 444, 444, 444, 444, 445, 449, 449, 449, 453,
+        454, 454, 458, 458, 458, 458, 459, 459, 459, 464, 471, 475, 481, 482, 482, 487,
+        488, 495, 496, 497, 510, 518, 530, 533, 536, 536, 551, 560, 567, 570, 572, 572,
+        572, 572, 574, 574, 582, 582, 582, 582, 584, 585, 585, 586, 588, 588, 588, 589,
+        589, 590, 591, 591, 591, 591, 591, 591, 594, 594, 594, 594, 594, 594, 594, 603,
+        603, 603, 603, 611, 611, 612, 612, 617, 617, 617, 617, 618, 619, 625, 625, 625,
+        627, 627, 627, 629, 629, 629, 629, 629, 629, 629, 643, 645, 645, 646, 659, 659,
+        659, 659, 666, 666, 666, 667, 668, 669, 677, 677, 677, 678, 678, 678, 681, 681,
+        681, 681, 686, 686, 686, 693, 696, 699, 706, 712, 715, 716, 718, 719, 720, 721,
+        725, 729, 738, 744, 747, 747, 754, 761, 768, 770, 771, 773, 775, 775, 776, 776,
+        781, 781, 781, 781, 781, 781, 781, 781, 782, 782, 782, 782, 782, 782, 784, 784,
+        784, 784, 784, 784, 786, 786, 786, 786, 786, 786, 786, 798, 800, 800, 800, 807,
+        807, 807, 807, 810, 810, 812, 812, 812, 812, 814, 814, 814, 816, 816, 816, 818,
+        818, 818, 818, 818, 818, 818, 831, 832, 835, 838, 848, 849, 853, 855, 868, 870,
+        872, 877, 880, 882, 887, 889, 889, 891, 895, 898, 908, 908, 908, 908, 915, 915,
+        915, 924, 927, 927, 927, 940, 940, 940, 940, 949, 949, 949, 949, 949, 951, 956,
+        958, 958, 958, 958, 958, 962, 962, 962, 962, 964, 964, 964, 978, 978, 981, 986,
+        995, 995, 998, 999, 1010, 1010, 1013, 1013, 1013, 1014, 1019, 1019, 1019, 1019, 1019, 1025,
+        1030, 1030, 1030, 1030, 1032, 1032, 1032, 1033, 1036, 1041, 1043, 1044, 1044, 1044, 1045, 1047,
+        1047, 1048, 1055, 1059, 1066, 1068, 1073, 1073, 1086, 1093, 1098, 1099, 1100, 1100, 1100, 1100,
+        1100, 1100, 1104, 1104, 1104, 1104, 1111, 1111, 1111, 1117, 1126, 1126, 1126, 1129, 1129, 1129,
+        1132, 1134, 1134, 1136, 1140, 1142, 1146, 1146, 1146, 1146, 1147, 1147, 1147, 1148, 1148, 1148,
+        1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1148, 1149, 1149, 1150, 1150, 1150,
+        1150, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1166, 1168, 1172, 1176, 1187, 1190, 1192, 1195,
+        1209, 1209, 1211, 1211, 1214, 1219, 1229, 1232, 1232, 1234, 1237, 1241, 1247, 1248, 1248, 1248,
+        1250, 1251, 1251, 1264, 1264, 1269, 1270, 1278, 1278, 1279, 1284, 1295, 1295, 1296, 1297, 1299,
+        1300, 1302, 1305, 1305, 1305, 1309, 1315, 1324, 1325, 1326, 1326, 1329, 1329, 1329, 1343, 1343,
+        1343, 1343, 1355, 1355, 1355, 1362, 1367, 1367, 1367, 1370, 1370, 1370, 1374, 1374, 1374, 1377,
+        1377, 1378, 1382, 1382, 1382, 1382, 1384, 1385, 1385, 1388, 1393, 1396, 1399, 1400, 1400, 1401,
+        1403, 1404, 1404, 1407, 1413, 1417, 1423, 1423, 1426, 1426, 1436, 1443, 1448, 1449, 1449, 1449,
+        1451, 1451, 1451, 1451, 1455, 1455, 1455, 1455, 1460, 1460, 1460, 1460, 1465, 1465, 1465, 1465,
+        1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1473,
+        1473, 1473, 1473, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+        1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,
+        1475, 1475, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+        1478, 1478, 1478, 1478, 1478, 1479, 1480, 1481, 1483, 1484, 1484, 1486, 1487, 1488, 1488, 1489,
+        1490, 1493, 1495, 1496, 1498, 1498, 1502, 1505, 1505, 1505, 1505, 1505, 1507, 1509, 1509, 1509,
+        1515, 1515, 1515, 1515, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1522,
+        1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523,
+};
+
+// The possible next letters, with '.' for the end of the name
+const char nameNextLetters[] =
+        "abcdefghijklmnopqrstuvwyzbcdiklmnpqrstuvzaeioryaehloruyaeiorsuya"
+        "bcdlmnopruaeouaeioraeioyanoxzaouaeioruaeiuyaeinouyaeiuybcklpruae"
+        "hilorsuyouaehiouyacehimoptuvyaehilruygmnrtaeiuaeeisaou.n.bioyahi"
+        "ort.aehioru.nafin.aeiou.aen.adlnprto.aeik.abcdefghijklmnoprstuy."
+        "aeio.acdegikotuy.asaehlorqu.acdefgikmnorstu.aceghilpstuw.aehilor"
+        "uz.lmrstaia.g.ehmn.bhjlnrta.lnrste.ahkaolorstaiudsbdl.dlmnprstza"
+        "aalprs.abeiouadn.i.clnraeu.rulrsgo.bcglnrs.bilmnrsuaaim.aopsalnr"
+        "s.aouc.bnss.cnrt.aelosuacdt.aefintaimru.adlmnosab.aeghilnoptuy.a"
+        "beiopu.acdegiknotu.nshit.abcefikmnoprst.acdeopst.aehiourst.e.efi"
+        "klnrtwlrae.khim.lr.cfilmnrs.elmnotuoenrtziu.blmnteuel.bcdeghilmn"
+        "rsuaia.abcdilmnrsuzilmnrsuia.bdemnrtvoblsdmpsy.dhknptaeraho.aghi"
+        "oubdlnst.ale.aaa..adl.aeo.acdeiotu.nprsthip.afgitz.achkst.aehort"
+        "mse.e.iabkntvdrtlp.abdfilmnrsuau.bimnrs.svaucrao.r.cdefghmnrstxa"
+        "aoyehu.cdhimnorshaeioae.abcefkmnopstaiae.aiou.aeai.cnsthoaeaehua"
+        "eh.cdmnprstxahmoprs.ciklmrstaru.abdgiklmnrstadmnrsuwzeiinrsthuhl"
+        "rsgr.bchikmnorstvxaeu.aeor.bilmprsv.gie.afhlnoprtxaeia.mprs.aeil"
+        "obkmnsmxraeoehikyeibadna.aeiluyaeiu.adegot.iaehsu.acdeinoprtuv.a"
+        "impsy.aehura.nsu.agilrt.adeiocdmnprstuaeulmriuio.aiorucprsxrnaai"
+        ".abcdikmnstwxzeoartu.aeo.abgilmnosz.aiaoaeo.acdeglmnostuxaeaei.a"
+        "eou.cdhmnprsteisai.aeaehicdkmsxu.la.bdfgiklmoqrtaehioe.dglmptua."
+        "aeiyacdnoprstuwe.ayo.lehiaeiuaeiouyahklmrstuaacnr.bfiklnprstuyz."
+        "abgijlmprtu.aeiruyackstaei.noraiualnrsrx.lorabehihik.ar.aall.aba"
+        "ceiou.bei.aehkuipu.aehinosuy.aceptu.aeiod.o.lnrghiln.jnorlsglnrs"
+        "znzasr.loordenyl.oenpennesaemn.in.iky.mnruv.dnai.sb";
+
+// The running total of how often each next letter followed the
+// state, so a letter is picked by finding where a random number
+// below the last total falls
+const uint16_t nameNextWeights[] = {
+        81, 95, 131, 148, 173, 182, 198, 222, 227, 233, 248, 265, 308, 330, 338, 370,
+        372, 391, 432, 463, 473, 481, 485, 488, 494, 1, 5, 8, 9, 10, 45, 47,
+        54, 55, 57, 64, 71, 76, 77, 79, 81, 3, 9, 11, 12, 13, 14, 19,
+        22, 26, 27, 32, 34, 35, 36, 3, 9, 12, 13, 14, 15, 16, 17, 1,
+        2, 3, 5, 11, 12, 15, 16, 17, 23, 25, 3, 6, 7, 9, 5, 7,
+        11, 15, 16, 7, 16, 18, 20, 24, 1, 2, 3, 4, 5, 3, 4, 6,
+        7, 9, 10, 12, 14, 15, 4, 8, 11, 14, 17, 8, 23, 34, 35, 37,
+        42, 43, 8, 13, 18, 21, 22, 1, 2, 3, 4, 5, 7, 8, 3, 7,
+        13, 15, 17, 23, 28, 29, 31, 32, 1, 2, 3, 5, 7, 10, 16, 18,
+        19, 13, 17, 22, 24, 28, 29, 30, 31, 33, 37, 38, 41, 7, 14, 21,
+        24, 25, 29, 30, 31, 1, 3, 4, 8, 10, 2, 5, 7, 8, 3, 4,
+        1, 2, 3, 3, 4, 6, 1, 2, 6, 7, 9, 10, 12, 1, 7, 8,
+        10, 14, 15, 5, 10, 11, 13, 14, 16, 18, 19, 1, 2, 3, 4, 5,
+        6, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 2, 5, 6, 7, 11,
+        12, 14, 15, 1, 6, 10, 12, 15, 17, 3, 7, 8, 10, 14, 15, 17,
+        20, 24, 36, 38, 41, 45, 48, 52, 54, 57, 59, 63, 67, 70, 72, 6,
+        14, 15, 17, 18, 15, 21, 23, 28, 29, 30, 36, 39, 42, 47, 50, 51,
+        1, 2, 3, 1, 3, 4, 5, 6, 7, 1, 3, 14, 22, 24, 29, 30,
+        32, 34, 45, 47, 48, 50, 51, 52, 53, 59, 60, 4, 6, 7, 8, 9,
+        12, 14, 15, 17, 22, 25, 26, 27, 5, 7, 10, 15, 16, 18, 21, 24,
+        25, 26, 1, 2, 3, 6, 7, 8, 2, 5, 2, 3, 1, 2, 4, 5,
+        6, 7, 3, 4, 8, 9, 10, 12, 14, 15, 2, 2, 5, 7, 10, 12,
+        14, 1, 1, 3, 5, 6, 1, 2, 1, 2, 3, 5, 6, 2, 3, 1,
+        1, 3, 1, 2, 3, 4, 5, 10, 12, 16, 19, 23, 26, 28, 29, 1,
+        1, 1, 4, 6, 8, 9, 4, 9, 11, 16, 17, 18, 20, 1, 3, 4,
+        2, 1, 1, 2, 3, 4, 12, 2, 4, 7, 1, 2, 3, 1, 3, 4,
+        1, 3, 10, 11, 12, 13, 16, 17, 19, 21, 2, 3, 4, 6, 10, 12,
+        14, 16, 1, 1, 2, 3, 4, 2, 6, 7, 8, 9, 1, 2, 4, 11,
+        12, 1, 5, 6, 7, 1, 1, 2, 3, 5, 1, 7, 8, 9, 10, 11,
+        2, 4, 7, 8, 10, 11, 12, 2, 3, 4, 5, 3, 7, 9, 10, 11,
+        12, 1, 2, 4, 5, 6, 7, 2, 1, 3, 5, 14, 16, 17, 20, 1,
+        1, 4, 8, 13, 16, 18, 25, 31, 32, 33, 35, 36, 37, 38, 2, 3,
+        4, 5, 10, 12, 13, 15, 1, 4, 5, 6, 13, 14, 16, 19, 20, 22,
+        23, 25, 1, 3, 4, 5, 6, 8, 5, 11, 13, 15, 19, 20, 26, 27,
+        29, 30, 34, 36, 37, 39, 41, 7, 9, 11, 12, 13, 14, 17, 19, 21,
+        1, 3, 6, 9, 10, 11, 12, 1, 7, 8, 1, 2, 1, 3, 1, 2,
+        3, 4, 5, 7, 8, 9, 2, 3, 1, 2, 1, 2, 1, 1, 1, 1,
+        2, 3, 1, 2, 3, 4, 6, 7, 9, 12, 15, 1, 2, 3, 4, 5,
+        6, 7, 8, 1, 3, 6, 7, 8, 9, 1, 1, 1, 2, 3, 4, 8,
+        9, 1, 2, 1, 2, 3, 4, 5, 7, 8, 11, 12, 15, 20, 24, 27,
+        32, 33, 36, 1, 2, 1, 2, 6, 8, 11, 12, 20, 25, 26, 28, 34,
+        37, 40, 41, 1, 2, 4, 5, 6, 7, 8, 1, 1, 1, 1, 2, 3,
+        4, 5, 7, 8, 9, 1, 2, 3, 4, 2, 3, 5, 6, 7, 29, 32,
+        33, 35, 37, 39, 41, 1, 2, 3, 2, 5, 7, 3, 5, 6, 7, 10,
+        11, 13, 1, 2, 4, 5, 6, 7, 1, 2, 3, 1, 1, 3, 1, 1,
+        4, 3, 6, 7, 8, 9, 13, 15, 18, 13, 18, 19, 23, 26, 27, 30,
+        32, 34, 2, 7, 9, 10, 11, 12, 4, 5, 6, 3, 7, 8, 9, 11,
+        12, 13, 15, 17, 18, 19, 20, 22, 23, 1, 5, 6, 8, 9, 10, 11,
+        3, 7, 1, 1, 2, 3, 4, 3, 1, 2, 4, 5, 6, 1, 1, 2,
+        1, 2, 3, 4, 6, 8, 9, 11, 15, 16, 17, 19, 20, 21, 1, 2,
+        3, 4, 5, 6, 7, 8, 9, 2, 5, 6, 1, 2, 1, 2, 1, 2,
+        1, 2, 8, 10, 12, 13, 14, 15, 16, 18, 20, 26, 28, 30, 31, 1,
+        1, 2, 3, 3, 4, 5, 2, 3, 4, 5, 7, 8, 10, 11, 12, 14,
+        2, 2, 4, 5, 6, 3, 7, 2, 8, 11, 12, 13, 14, 15, 17, 23,
+        27, 28, 30, 31, 1, 2, 2, 3, 1, 7, 10, 11, 13, 1, 2, 3,
+        3, 5, 2, 3, 5, 6, 8, 3, 5, 1, 2, 1, 2, 3, 4, 3,
+        4, 5, 1, 2, 3, 4, 5, 6, 7, 11, 12, 14, 1, 2, 3, 4,
+        5, 6, 8, 5, 6, 7, 11, 16, 17, 24, 25, 27, 2, 3, 4, 1,
+        2, 3, 6, 7, 9, 10, 14, 15, 21, 25, 27, 31, 3, 5, 7, 13,
+        18, 20, 21, 22, 23, 1, 2, 1, 3, 4, 7, 8, 1, 2, 1, 3,
+        4, 8, 1, 2, 11, 13, 14, 18, 20, 21, 22, 24, 25, 28, 30, 31,
+        32, 33, 1, 3, 4, 3, 5, 6, 12, 13, 11, 13, 14, 15, 17, 19,
+        20, 23, 25, 2, 3, 4, 1, 1, 7, 9, 10, 11, 13, 14, 15, 16,
+        17, 18, 3, 5, 7, 2, 4, 5, 7, 9, 13, 3, 5, 6, 7, 8,
+        9, 1, 2, 3, 4, 13, 1, 2, 1, 1, 2, 3, 1, 2, 3, 4,
+        5, 1, 2, 1, 1, 1, 2, 1, 1, 4, 5, 6, 8, 9, 11, 2,
+        7, 8, 9, 13, 14, 17, 22, 24, 27, 28, 1, 2, 1, 5, 6, 7,
+        9, 12, 15, 16, 18, 21, 25, 27, 28, 29, 30, 31, 32, 33, 13, 15,
+        16, 17, 18, 19, 20, 1, 2, 4, 9, 10, 1, 1, 1, 3, 4, 5,
+        4, 5, 6, 7, 9, 15, 16, 2, 7, 8, 15, 17, 22, 1, 2, 3,
+        5, 6, 7, 9, 10, 11, 1, 2, 3, 4, 6, 9, 1, 2, 1, 6,
+        1, 2, 3, 4, 1, 2, 1, 2, 3, 7, 1, 1, 1, 1, 2, 3,
+        12, 13, 14, 17, 19, 20, 24, 26, 33, 35, 39, 40, 41, 43, 1, 2,
+        1, 2, 3, 5, 3, 5, 6, 7, 2, 3, 4, 5, 7, 8, 9, 10,
+        11, 15, 16, 2, 3, 4, 1, 3, 1, 2, 3, 1, 9, 11, 12, 15,
+        16, 17, 19, 22, 24, 29, 32, 35, 37, 2, 3, 1, 3, 4, 1, 4,
+        5, 6, 7, 1, 2, 3, 4, 7, 11, 15, 16, 21, 23, 1, 2, 3,
+        2, 3, 1, 2, 4, 5, 6, 9, 10, 1, 2, 4, 6, 12, 14, 1,
+        1, 2, 1, 8, 9, 13, 14, 15, 16, 17, 22, 23, 24, 25, 27, 30,
+        1, 4, 9, 10, 11, 1, 3, 4, 6, 8, 9, 11, 12, 13, 1, 2,
+        4, 5, 6, 7, 1, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13, 1,
+        1, 1, 2, 1, 2, 3, 3, 4, 8, 4, 6, 9, 10, 1, 3, 4,
+        7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 1, 1, 3,
+        4, 2, 3, 4, 6, 8, 10, 17, 18, 25, 26, 27, 28, 29, 30, 1,
+        3, 4, 5, 6, 7, 10, 11, 12, 20, 21, 22, 7, 12, 21, 22, 23,
+        25, 26, 3, 4, 5, 7, 9, 2, 3, 4, 6, 7, 8, 10, 2, 9,
+        10, 1, 1, 3, 6, 7, 1, 2, 1, 1, 2, 3, 1, 2, 4, 5,
+        6, 1, 2, 3, 2, 3, 4, 1, 1, 1, 2, 1, 2, 3, 4, 3,
+        4, 5, 7, 8, 11, 4, 7, 10, 11, 1, 2, 3, 4, 5, 6, 1,
+        2, 3, 3, 7, 8, 9, 10, 11, 14, 15, 19, 20, 39, 41, 43, 44,
+        45, 46, 47, 1, 3, 4, 5, 6, 1, 3, 4, 1, 3, 5, 6, 1,
+        2, 3, 4, 5, 1, 2, 3, 4, 5, 1, 2, 1, 2, 3, 4, 5,
+        6, 1, 2, 1, 2, 1, 1, 1, 1, 1, 3, 1, 2, 3, 1, 1,
+        1, 2, 1, 2, 3, 1, 2, 3, 2, 3, 1, 2, 3, 4, 2, 4,
+        5, 2, 3, 1, 2, 1, 2, 3, 5, 6, 7, 1, 3, 4, 1, 1,
+        1, 1, 2,
+};
+
+#endif //SOLAR_SYSTEM_NAME_TABLES_H
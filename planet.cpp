@@ -4,19 +4,10 @@
 
 #include "planet.h"
 
-// Selects a random float in the range of min to max.
-float randRange(float min, float max) {
-    float random = ((float) rand()) / (float) RAND_MAX;
-    float diff = max - min;
-    float r = random * diff;
-
-    return min + r;
-}
-
 // Selects a random colour out of a list of
 // 14. They're all quite nice.
-sf::Color randomColour() {
-    std::vector<sf::Color> colours{
+sf::Color randomColour(Random &random) {
+    static const sf::Color colours[]{
             sf::Color( 50, 150, 232),
             sf::Color( 40, 170, 110),
 
@@ -39,16 +30,15 @@ sf::Color randomColour() {
             sf::Color( 50, 200,  78),
     };
 
-    return colours[rand() % colours.size()];
+    return colours[random.below(sizeof(colours) / sizeof(colours[0]))];
 }
 
-Planet::Planet(float distance) {
-    distanceFromSun = distance;
-
-    // Population has 40% chance to be 0, otherwise it's random from MIN_POPULATION to MAX_POPULATION
-    resources.store[ResourceType::Population] = rand() > RAND_MAX * 0.4 ? int(randRange(MIN_POPULATION, MAX_POPULATION)) : 0;
+Planet::Planet(PlanetStore *store, unsigned int index, bool inhabited, Random &random)
+        : store(store), index(index), name(nullptr), inhabitants(nullptr) {
+    // An inhabited planet's population is random from MIN_POPULATION to MAX_POPULATION
+    setResource(Population, inhabited ? int(random.range(MIN_POPULATION, MAX_POPULATION)) : 0);
 
-    earthLikeness = randRange(MIN_EARTH_LIKENESS, MAX_EARTH_LIKENESS);
+    earthLikeness = random.range(MIN_EARTH_LIKENESS, MAX_EARTH_LIKENESS);
     radius = earthLikeness * EARTH_RADIUS;
     mass = 4.0f / 3.0f * PI * (radius * radius * radius) * EARTH_DENSITY;
 
@@ -56,212 +46,53 @@ Planet::Planet(float distance) {
     // Expressed relative to Earth Gravity acceleration in surface (g).
     gravity = GRAVITY_CONST * mass / (radius * radius) / EARTH_G;
 
+    // The size on screen, which is used every frame for picking
+    store->pixelRadius[index] = radius / (ASSUMED_WIDTH / WIDTH_RATIO) * RADIUS_TO_PIXEL_FACTOR;
+
     // Find surface area and then calculate capacity based on density per area.
-    capacity = (4 * PI * radius * radius) * randRange(MIN_DENSITY, MAX_DENSITY);
+    store->capacity[index] = (4 * PI * radius * radius) * random.range(MIN_DENSITY, MAX_DENSITY);
 
     // biodiveristy is just the Earth-likeness of the planet scaled between 1-10
     // this assumes a bigger planet (earthLikeness >> 1) would be more diverse, etc.
-    biodiversity = ((((earthLikeness - MIN_EARTH_LIKENESS) * (10-1)) / (MAX_EARTH_LIKENESS - MIN_EARTH_LIKENESS)) + 1);
+    store->biodiversity[index] = ((((earthLikeness - MIN_EARTH_LIKENESS) * (10-1)) / (MAX_EARTH_LIKENESS - MIN_EARTH_LIKENESS)) + 1);
 
-    // Angle is from 0 to 360
-    angle = randRange(0, 360);
+    // Angle is from 0 to 360, wrapped to radians
+    store->angle[index] = fmodf(random.range(0, 360), 2 * PI);
 
     // Speed is from MIN_PLANET_SPEED to MAX_PLANET_SPEED
-    speed = randRange(MIN_PLANET_SPEED, MAX_PLANET_SPEED);
-
-    colour = randomColour();
-    name = Planet::randomName();
+    store->speed[index] = random.range(MIN_PLANET_SPEED, MAX_PLANET_SPEED);
 
-    float pixRadius = getPixelRadius();
-    shape = sf::CircleShape(pixRadius);
-    shape.setFillColor(colour);
-    shape.setOrigin(pixRadius, pixRadius);
+    colour = randomColour(random);
+}
 
-    orbit = sf::CircleShape(distanceFromSun, 100);
-    orbit.setFillColor(sf::Color::Transparent);
-    orbit.setOutlineColor(sf::Color(ORBIT_COLOUR));
-    orbit.setOutlineThickness(N(2));
-    orbit.setPosition(SYSTEM_X, SYSTEM_Y);
-    orbit.setOrigin(distanceFromSun, distanceFromSun);
+void Planet::placeInOrbit(float distance) {
+    store->distanceFromSun[index] = distance;
 
-    float borderPixRadius = getBorderPixelRadius();
-    border = sf::CircleShape(borderPixRadius);
-    border.setFillColor(sf::Color::Transparent);
-    border.setOutlineColor(colour);
-    border.setOutlineThickness(PLANET_BORDER_THICKNESS);
-    border.setOrigin(borderPixRadius, borderPixRadius);
-}
+    // The speed along the orbit, as an angle per second. It never
+    // changes, so it's only calculated once.
+    store->angularSpeed[index] = atanf(store->speed[index] / distance);
 
-float Planet::getPixelRadius() {
-    return radius / (ASSUMED_WIDTH / WIDTH_RATIO) * RADIUS_TO_PIXEL_FACTOR;
+    float angle = store->angle[index];
+    store->x[index] = cosf(angle) * distance + SYSTEM_X;
+    store->y[index] = sinf(angle) * distance + SYSTEM_Y;
 }
 
 float Planet::getBorderPixelRadius() {
     return getPixelRadius() + PLANET_BORDER_EXTRA_PIXELS + PLANET_BORDER_THICKNESS;
 }
 
-void Planet::render(sf::RenderWindow *win) {
-    win->draw(shape);
-}
-
-void Planet::renderOrbit(sf::RenderWindow *win) {
-    win->draw(orbit);
-}
-
-void Planet::renderBorder(sf::RenderWindow *win) {
-    win->draw(border);
-}
-
-void Planet::update(Game* game, float dt) {
-    float angleDiff = atanf(speed / distanceFromSun);
-    angle += angleDiff * dt;
-
-    sf::Vector2f newPosition = getPosition(SYSTEM_CENTER);
-    shape.setPosition(newPosition);
-    border.setPosition(newPosition);
-
-    while (shipQueue.size() > 0) {
-        Spaceship ship = shipQueue.back();
-        shipQueue.pop_back();
-        game->ships.push_back(ship);
-    }
-
-	// TODO have people die off if there's not enough food
-    // Update Population using logistic model
-    long initialPop = resources.store[Population]; // Initial population of planet
-    double k = 0.1;                               // Relative growth rate coefficient
-    double A = (capacity - initialPop) / initialPop;
-    double e = std::exp(1.0);
-
-    // Start reducing population due to shortage of food
-    if(resources.store[Food]==0){
-        k = -0.1;
-    }
-
-    if (initialPop != 0) {
-        resources.store[Population] = long(capacity / (1 + A * pow(e, (-k * dt))));
-    }
-
-	// TODO: would like to implement people management ex. # of framers, scientists, engineers, 
-	// laborers and resource production would be based of this
-	int number_of_farmers = resources.store[Population];
-    if(number_of_farmers > farmersCap) {
-        number_of_farmers = farmersCap;
-    }
-
-    // Update others resources stats
-    resources.store[Species] += randRange(-500, 10000);
-    resources.store[Metal] += randRange(-500, 10000);
-    resources.store[Wood] += randRange(-500, 10000);
-    resources.store[Water] += randRange(-500, 10000);
-
-  	// If there's no people their shouldn't be any weapons
-  	if (resources.store[Population] > 0) {
-  		resources.store[Weaponary] = randRange(0, 10000);
-  	}
-
-	  // Each farmer on the planet can grow food equal to the bio diversity of the planet, however each person must eats one
-    if(!resources.store[Population]) { // No farmers, no food
-        resources.store[Food] = 0;
-    } else {
-        resources.store[Food] = int((number_of_farmers*biodiversity)/std::sqrt(resources.store[Population]));
-    }
-
-    // Cap on all resources
-    resources.store[Species] = max(0L, resources.store[Species]);
-    resources.store[Metal] = max(0L, resources.store[Metal]);
-    resources.store[Wood] = max(0L, resources.store[Wood]);
-    resources.store[Water] = max(0L, resources.store[Water]);
-    resources.store[Food] = max(0L, resources.store[Food]);
-
-    resources.store[Species] = min(speciesCap, resources.store[Species]);
-    resources.store[Metal] = min(metalCap, resources.store[Metal]);
-    resources.store[Wood] = min(woodCap, resources.store[Wood]);
-    resources.store[Water] = min(waterCap, resources.store[Water]);
-    resources.store[Food] = min(foodCap, resources.store[Food]);
-}
-
-sf::Vector2f Planet::getPosition(sf::Vector2f center) {
-    sf::Vector2f direction(
-            cos(angle),
-            sin(angle)
-    );
-
-    return direction * distanceFromSun + center;
-}
-
 bool Planet::contains(sf::Vector2f point) {
-    sf::Vector2f diff = point - shape.getPosition();
+    sf::Vector2f diff = point - getPosition();
     float distance = diff.x * diff.x + diff.y * diff.y;
+    float pixRadius = getPixelRadius();
 
-    return distance < (getPixelRadius() * getPixelRadius());
-}
-
-// TODO: Improve inhabitant name generation, maybe using Markov chains.
-std::string Planet::getInhabitantName() {
-    if (resources.store[ResourceType::Population] == 0) return "N/A";
-
-    std::string inhabitants = name;
-
-    char last = name[name.size() - 1];
-
-    if (last == 'a') {
-        // Can only end in 'a' if it ends in 'ia'
-        // Therefore, 'ns' is added instead of 'ians'
-
-        inhabitants += "ns";
-    } else {
-        // Replace trailing 's' with 't'
-        // e.g. Mars -> Martians
-        if (last == 's') inhabitants[inhabitants.size() - 1] = 't';
-
-        inhabitants += "ians";
-    }
-
-    return inhabitants;
-}
-
-// TODO: Improve name generation, maybe using Markov chains.
-std::string Planet::randomName() {
-    std::string name;
-    int letters = rand() % 4 + 4;
-
-    char vowels[]{'a', 'e', 'i', 'o', 'u'};
-
-    // Some consonants have been removed, since they can make bad planet names.
-    char consonants[]{'b', 'c', 'd', 'f', 'g', 'k', 'l', 'm', 'n', 'p', 'q', 'r', 's', 't', 'v', 'z'};
-
-    // Randomly sometimes start with a consonant
-    if (rand() < RAND_MAX / 2) name += consonants[rand() % sizeof(consonants)];
-
-    // Fill the string with n letters, alternating vowels and consonants
-    for (int i = 0; i < letters; i += 2) {
-
-        // Append a vowel-consonant pair
-        name += vowels[rand() % sizeof(vowels)];
-        name += consonants[rand() % sizeof(consonants)];
-
-        // Add a 'u' after any 'q' which isn't at the end of the name
-        if (name[name.size() - 1] == 'q' && i + 2 < letters) {
-            name += 'u';
-            i++;
-        }
-    }
-
-    // Add a -ia suffix a quarter of the time
-    if (rand() < RAND_MAX / 4) name += "ia";
-
-    // Capitalise first letter
-    name[0] -= 32;
-
-    return name;
+    return distance < pixRadius * pixRadius;
 }
 
-void Planet::launchShip(Resources res, Planet *destination) {
-    Spaceship ship(this, destination, res);
-    shipQueue.push_back(ship);
+const char *Planet::getInhabitantName() {
+    return resource(Population) == 0 ? "N/A" : inhabitants;
 }
 
 bool Planet::isInhabited() {
-    return resources.store[Population] > 0;
+    return resource(Population) > 0;
 }
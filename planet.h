@@ -14,49 +14,38 @@
 
 #include "config.h"
 #include "resource.h"
-#include "spaceship.h"
-#include "game.h"
-
-class Game;
-
+#include "planet_store.h"
+#include "random.h"
+
+/** class Planet
+ *
+ * A planet's descriptive properties. The state which
+ * changes every tick (its orbit and resources) lives in a
+ * PlanetStore, at this planet's index, and its shapes live
+ * in a PlanetVisual.
+ */
 class Planet {
-    const long foodCap = 50000;
-    const long farmersCap = 5000000;
-    const long metalCap = 50000000;
-    const long woodCap = 50000000;
-    const long waterCap = 50000000;
-    const long speciesCap = 500000;
-    
-    sf::CircleShape shape;
-    sf::CircleShape orbit;
-    sf::CircleShape border;
-
-    // The ships ready to be launched. This is necessary
-    // because the Game instance isn't accessable from launchShip(),
-    // so update() iterates this queue and launches all the ships in it.
-    std::vector<Spaceship> shipQueue;
+    // The store holding this planet's simulation state
+    PlanetStore *store;
 
 public:
-    // The planet's name
-    std::string name;
+    // The planet's index into its PlanetStore
+    unsigned int index;
+
+    // The planet's name, and the name of its inhabitants. They
+    // point into the arena of the NameGenerator which made them.
+    const char *name;
+    const char *inhabitants;
 
     // The planet's colour
     sf::Color colour;
 
-    // The planet's resource store
-    Resources resources;
-
     // The properties. This might be moved to its own struct
     // in the future.
     float earthLikeness;    // How likely the planet is to Earth (1f == Earth)
     float radius;           // x10^2AU
-    float distanceFromSun;  // miles
     float orbitalPeriod;    // in time increments, should be calculated by Kepler's Third Law using distanceFromSun
     float mass;             // yg (yottagrams)
-    float angle;            // º
-    float speed;            // px/s, calculated from Kepler's Second Law using distanceFromSun
-    float biodiversity;	    // between 1-10
-    float capacity;         // capacity
     float gravity;          // relative to Earth's g
     float airPressureSurface; // relative to Earth's atm, at surface
     float atmosphereHeight; // in miles, pressure drops linearly to 0 at altitude==atmosphereHeight
@@ -65,16 +54,41 @@ public:
     int moons;              // larger planets tend to have more
     int rings;              // 0 for none, else display n rings as concentric circles above equator
 
-    // Explicit since there's only one parameter.
-    explicit Planet(float radius);
+    // Generates the planet at the given index of the store from the
+    // given random numbers, populating it if it's to be inhabited.
+    // It isn't in orbit until placeInOrbit is called, and it's
+    // named separately, by a NameGenerator.
+    Planet(PlanetStore*, unsigned int index, bool inhabited, Random&);
+
+    // Puts the planet in its orbit, at the given distance from the sun
+    void placeInOrbit(float distance);
 
-    void render(sf::RenderWindow*);
-    void renderOrbit(sf::RenderWindow*);
-    void renderBorder(sf::RenderWindow*);
-    void update(Game*, float dt);
+    // Refers to a planet which is already in the store, e.g. one
+    // being loaded, leaving its properties to be filled in
+    Planet(PlanetStore *store, unsigned int index): store(store), index(index), name(nullptr), inhabitants(nullptr) {}
 
-    // Calculates the planet's radius in pixels
-    float getPixelRadius();
+    // Accessors for the state kept in the store
+    float getAngle() { return store->angle[index]; }              // radians
+    float getSpeed() { return store->speed[index]; }              // px/s
+    float getAngularSpeed() { return store->angularSpeed[index]; } // radians/s
+    float getDistanceFromSun() { return store->distanceFromSun[index]; } // px
+    float getCapacity() { return store->capacity[index]; }
+    float getBiodiversity() { return store->biodiversity[index]; } // between 1-10
+
+    // Gets/sets one of the planet's resource counts
+    int64_t resource(ResourceType type) { return store->resources[type][index]; }
+    void setResource(ResourceType type, int64_t count) { store->setResource(index, type, count); }
+
+    // Gets the version of one of the planet's resource counts,
+    // which changes whenever the count does
+    uint32_t getVersion(ResourceType type) { return store->versions[type][index]; }
+
+    // Gets/sets all of the planet's resources at once
+    Resources getResources() { return store->getResources(index); }
+    void setResources(const Resources &res) { store->setResources(index, res); }
+
+    // Gets the planet's radius in pixels
+    float getPixelRadius() { return store->pixelRadius[index]; }
 
     // Calculates the planet border's radius in pixels
     float getBorderPixelRadius();
@@ -83,7 +97,7 @@ public:
     float getOrbitalPeriod()
     {
         // convert distanceFromSun in miles to AU
-        float distanceInAU = distanceFromSun * 1.60934f; // miles to kilometers
+        float distanceInAU = getDistanceFromSun() * 1.60934f; // miles to kilometers
         distanceInAU *= 1000; // kilometers to meters
         distanceInAU /= AU_TO_METER; // meters to AU
         // Kepler's Third Law
@@ -112,21 +126,12 @@ public:
     // the planet's bounds
     bool contains(sf::Vector2f);
 
-    // Launches a ship from this planet with the
-    // given resources, towards the specified planet.
-    void launchShip(Resources, Planet*);
-
-    // Gets the current position relative to the
-    // parameter.
-    sf::Vector2f getPosition(sf::Vector2f);
-
-    // Generates the name of the inhabitants. It is
-    // determinate (i.e. not random,) but if it was,
-    // a few things would have to change.
-    std::string getInhabitantName();
+    // Gets the planet's position as of the last tick. Positions
+    // are calculated once per tick for every planet, by the store.
+    sf::Vector2f getPosition() { return sf::Vector2f(store->x[index], store->y[index]); }
 
-    // Generates a random planet name.
-    static std::string randomName();
+    // Gets the name of the inhabitants, or N/A if there aren't any
+    const char *getInhabitantName();
 
     // A planet can be inhabitet/uninhabited.
     bool isInhabited();
@@ -0,0 +1,506 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "config.h"
+#include "planet_kernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define PLANET_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+#define TWO_PI_F 6.28318530717958647692f
+
+// Constants for the single precision sin/cos approximations
+// (from Cephes.) The angle is reduced to [-pi/4, pi/4] by
+// subtracting a multiple of pi/4 in three parts, for precision.
+#define FOUR_OVER_PI 1.27323954473516f
+#define MINUS_DP1   -0.78515625f
+#define MINUS_DP2   -2.4187564849853515625e-4f
+#define MINUS_DP3   -3.77489497744594108e-8f
+#define SIN_P0      -1.9515295891E-4f
+#define SIN_P1       8.3321608736E-3f
+#define SIN_P2      -1.6666654611E-1f
+#define COS_P0       2.443315711809948E-005f
+#define COS_P1      -1.388731625493765E-003f
+#define COS_P2       4.166664568298827E-002f
+
+// Adding this to an integer below 2^52 (as bits), or to a double
+// of such an integer, converts between the two representations.
+#define MAGIC_BITS 0x4330000000000000LL
+#define MAGIC_DOUBLE 4503599627370496.0
+
+
+/************/
+/** Scalar **/
+/************/
+
+static void advanceOrbitsScalar(float *angle, const float *angularSpeed, const float *distance,
+                                float *x, float *y, unsigned int n, float dt, float cx, float cy) {
+    for (unsigned int i = 0; i < n; i++) {
+        float a = angle[i] + angularSpeed[i] * dt;
+        a -= floorf(a / TWO_PI_F) * TWO_PI_F;
+        angle[i] = a;
+
+        x[i] = cosf(a) * distance[i] + cx;
+        y[i] = sinf(a) * distance[i] + cy;
+    }
+}
+
+static void growPopulationsScalar(int64_t *population, const int64_t *food, const float *capacity,
+                                  unsigned int n, double growth, double decline) {
+    for (unsigned int i = 0; i < n; i++) {
+        if (population[i] == 0) continue;
+
+        // P(t + dt) = K / (1 + A e^(-k dt)) where A = (K - P) / P,
+        // rearranged so that it only needs one division.
+        double p = population[i];
+        double cap = capacity[i];
+        double e = food[i] == 0 ? decline : growth;
+
+        population[i] = int64_t(cap * p / (p + (cap - p) * e));
+    }
+}
+
+static double relaxRelationshipRowScalar(float *rel, const float *x, const float *y, const float *reputation,
+                                         const float *arms, const float *weight, double *sums,
+                                         unsigned int n, const RelationshipRow &row) {
+    double sum = 0;
+
+    for (unsigned int k = 0; k < n; k++) {
+        float r = rel[k];
+
+        // Closeness falls off with the square of the distance,
+        // which saves a square root per edge
+        float dx = x[k] - row.x, dy = y[k] - row.y;
+        float closeness = std::max(0.f, 1 - (dx * dx + dy * dy) * row.inverseRange2);
+
+        r += row.relax * ((row.reputation + reputation[k]) / 2 - r);
+        r += row.warm * closeness - row.sour * (row.arms + arms[k]);
+        r = std::min(MAX_PLANET_REL, std::max(MIN_PLANET_REL, r));
+
+        rel[k] = r;
+        sum += double(r) * weight[k];
+        sums[k] += double(r) * row.weight;
+    }
+
+    return sum;
+}
+
+
+#ifdef PLANET_KERNELS_X86
+
+/*********/
+/** SSE **/
+/*********/
+
+__attribute__((target("sse4.1")))
+static inline void sincosSSE(__m128 x, __m128 *s, __m128 *c) {
+    const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+
+    __m128 signSin = _mm_and_ps(x, signMask);
+    x = _mm_andnot_ps(signMask, x);
+
+    // Find the octant, rounded up to an even number
+    __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(FOUR_OVER_PI)));
+    j = _mm_add_epi32(j, _mm_set1_epi32(1));
+    j = _mm_and_si128(j, _mm_set1_epi32(~1));
+    __m128 jf = _mm_cvtepi32_ps(j);
+
+    __m128 swapSin = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+    __m128 polyMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+    __m128 signCos = _mm_castsi128_ps(_mm_slli_epi32(
+            _mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+    signSin = _mm_xor_ps(signSin, swapSin);
+
+    x = _mm_add_ps(x, _mm_mul_ps(jf, _mm_set1_ps(MINUS_DP1)));
+    x = _mm_add_ps(x, _mm_mul_ps(jf, _mm_set1_ps(MINUS_DP2)));
+    x = _mm_add_ps(x, _mm_mul_ps(jf, _mm_set1_ps(MINUS_DP3)));
+
+    __m128 z = _mm_mul_ps(x, x);
+
+    __m128 cosPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_P0), z), _mm_set1_ps(COS_P1));
+    cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(COS_P2));
+    cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, z), z);
+    cosPoly = _mm_sub_ps(cosPoly, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    cosPoly = _mm_add_ps(cosPoly, _mm_set1_ps(1.f));
+
+    __m128 sinPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_P0), z), _mm_set1_ps(SIN_P1));
+    sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(SIN_P2));
+    sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), x), x);
+
+    *s = _mm_xor_ps(_mm_blendv_ps(cosPoly, sinPoly, polyMask), signSin);
+    *c = _mm_xor_ps(_mm_blendv_ps(sinPoly, cosPoly, polyMask), signCos);
+}
+
+__attribute__((target("sse4.1")))
+static void advanceOrbitsSSE(float *angle, const float *angularSpeed, const float *distance,
+                             float *x, float *y, unsigned int n, float dt, float cx, float cy) {
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 twoPi = _mm_set1_ps(TWO_PI_F);
+    const __m128 vcx = _mm_set1_ps(cx);
+    const __m128 vcy = _mm_set1_ps(cy);
+
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 a = _mm_add_ps(_mm_loadu_ps(angle + i), _mm_mul_ps(_mm_loadu_ps(angularSpeed + i), vdt));
+        a = _mm_sub_ps(a, _mm_mul_ps(_mm_floor_ps(_mm_div_ps(a, twoPi)), twoPi));
+        _mm_storeu_ps(angle + i, a);
+
+        __m128 s, c;
+        sincosSSE(a, &s, &c);
+
+        __m128 d = _mm_loadu_ps(distance + i);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_mul_ps(c, d), vcx));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_mul_ps(s, d), vcy));
+    }
+
+    advanceOrbitsScalar(angle + i, angularSpeed + i, distance + i, x + i, y + i, n - i, dt, cx, cy);
+}
+
+__attribute__((target("sse4.1")))
+static void growPopulationsSSE(int64_t *population, const int64_t *food, const float *capacity,
+                               unsigned int n, double growth, double decline) {
+    const __m128d vGrowth = _mm_set1_pd(growth);
+    const __m128d vDecline = _mm_set1_pd(decline);
+    const __m128i magicBits = _mm_set1_epi64x(MAGIC_BITS);
+    const __m128d magicDouble = _mm_set1_pd(MAGIC_DOUBLE);
+    const __m128i zero = _mm_setzero_si128();
+
+    unsigned int i = 0;
+
+    for (; i + 2 <= n; i += 2) {
+        __m128i pi = _mm_loadu_si128((const __m128i*) (population + i));
+        __m128d p = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(pi, magicBits)), magicDouble);
+        __m128d cap = _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd((const double*) (capacity + i))));
+
+        __m128d noFood = _mm_castsi128_pd(_mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*) (food + i)), zero));
+        __m128d extinct = _mm_castsi128_pd(_mm_cmpeq_epi64(pi, zero));
+        __m128d e = _mm_blendv_pd(vGrowth, vDecline, noFood);
+
+        __m128d next = _mm_div_pd(_mm_mul_pd(cap, p), _mm_add_pd(p, _mm_mul_pd(_mm_sub_pd(cap, p), e)));
+        next = _mm_round_pd(next, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        next = _mm_andnot_pd(extinct, next);
+
+        __m128i out = _mm_xor_si128(_mm_castpd_si128(_mm_add_pd(next, magicDouble)), magicBits);
+        _mm_storeu_si128((__m128i*) (population + i), out);
+    }
+
+    growPopulationsScalar(population + i, food + i, capacity + i, n - i, growth, decline);
+}
+
+
+__attribute__((target("sse4.1")))
+static double relaxRelationshipRowSSE(float *rel, const float *x, const float *y, const float *reputation,
+                                      const float *arms, const float *weight, double *sums,
+                                      unsigned int n, const RelationshipRow &row) {
+    const __m128 xi = _mm_set1_ps(row.x), yi = _mm_set1_ps(row.y);
+    const __m128 repi = _mm_set1_ps(row.reputation), armsi = _mm_set1_ps(row.arms);
+    const __m128 relax = _mm_set1_ps(row.relax), warm = _mm_set1_ps(row.warm), sour = _mm_set1_ps(row.sour);
+    const __m128 inverseRange2 = _mm_set1_ps(row.inverseRange2);
+    const __m128 half = _mm_set1_ps(0.5f), one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+    const __m128 minRel = _mm_set1_ps(MIN_PLANET_REL), maxRel = _mm_set1_ps(MAX_PLANET_REL);
+    const __m128d weighti = _mm_set1_pd(row.weight);
+
+    __m128d sumLo = _mm_setzero_pd(), sumHi = _mm_setzero_pd();
+    unsigned int k = 0;
+
+    for (; k + 4 <= n; k += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + k), xi);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + k), yi);
+        __m128 distance2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 closeness = _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(distance2, inverseRange2)));
+
+        __m128 r = _mm_loadu_ps(rel + k);
+        __m128 target = _mm_mul_ps(_mm_add_ps(repi, _mm_loadu_ps(reputation + k)), half);
+        r = _mm_add_ps(r, _mm_mul_ps(relax, _mm_sub_ps(target, r)));
+        r = _mm_add_ps(r, _mm_sub_ps(_mm_mul_ps(warm, closeness), _mm_mul_ps(sour, _mm_add_ps(armsi, _mm_loadu_ps(arms + k)))));
+        r = _mm_min_ps(maxRel, _mm_max_ps(minRel, r));
+        _mm_storeu_ps(rel + k, r);
+
+        __m128 w = _mm_loadu_ps(weight + k);
+        __m128d rLo = _mm_cvtps_pd(r), rHi = _mm_cvtps_pd(_mm_movehl_ps(r, r));
+        sumLo = _mm_add_pd(sumLo, _mm_mul_pd(rLo, _mm_cvtps_pd(w)));
+        sumHi = _mm_add_pd(sumHi, _mm_mul_pd(rHi, _mm_cvtps_pd(_mm_movehl_ps(w, w))));
+
+        _mm_storeu_pd(sums + k, _mm_add_pd(_mm_loadu_pd(sums + k), _mm_mul_pd(rLo, weighti)));
+        _mm_storeu_pd(sums + k + 2, _mm_add_pd(_mm_loadu_pd(sums + k + 2), _mm_mul_pd(rHi, weighti)));
+    }
+
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(sumLo, sumHi));
+
+    return lanes[0] + lanes[1] + relaxRelationshipRowScalar(rel + k, x + k, y + k, reputation + k, arms + k,
+                                                            weight + k, sums + k, n - k, row);
+}
+
+/**********/
+/** AVX2 **/
+/**********/
+
+__attribute__((target("avx2,fma")))
+static inline void sincosAVX2(__m256 x, __m256 *s, __m256 *c) {
+    const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+
+    __m256 signSin = _mm256_and_ps(x, signMask);
+    x = _mm256_andnot_ps(signMask, x);
+
+    // Find the octant, rounded up to an even number
+    __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(FOUR_OVER_PI)));
+    j = _mm256_add_epi32(j, _mm256_set1_epi32(1));
+    j = _mm256_and_si256(j, _mm256_set1_epi32(~1));
+    __m256 jf = _mm256_cvtepi32_ps(j);
+
+    __m256 swapSin = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29));
+    __m256 polyMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_setzero_si256()));
+    __m256 signCos = _mm256_castsi256_ps(_mm256_slli_epi32(
+            _mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+    signSin = _mm256_xor_ps(signSin, swapSin);
+
+    x = _mm256_fmadd_ps(jf, _mm256_set1_ps(MINUS_DP1), x);
+    x = _mm256_fmadd_ps(jf, _mm256_set1_ps(MINUS_DP2), x);
+    x = _mm256_fmadd_ps(jf, _mm256_set1_ps(MINUS_DP3), x);
+
+    __m256 z = _mm256_mul_ps(x, x);
+
+    __m256 cosPoly = _mm256_fmadd_ps(_mm256_set1_ps(COS_P0), z, _mm256_set1_ps(COS_P1));
+    cosPoly = _mm256_fmadd_ps(cosPoly, z, _mm256_set1_ps(COS_P2));
+    cosPoly = _mm256_mul_ps(_mm256_mul_ps(cosPoly, z), z);
+    cosPoly = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), cosPoly);
+    cosPoly = _mm256_add_ps(cosPoly, _mm256_set1_ps(1.f));
+
+    __m256 sinPoly = _mm256_fmadd_ps(_mm256_set1_ps(SIN_P0), z, _mm256_set1_ps(SIN_P1));
+    sinPoly = _mm256_fmadd_ps(sinPoly, z, _mm256_set1_ps(SIN_P2));
+    sinPoly = _mm256_fmadd_ps(_mm256_mul_ps(sinPoly, z), x, x);
+
+    *s = _mm256_xor_ps(_mm256_blendv_ps(cosPoly, sinPoly, polyMask), signSin);
+    *c = _mm256_xor_ps(_mm256_blendv_ps(sinPoly, cosPoly, polyMask), signCos);
+}
+
+__attribute__((target("avx2,fma")))
+static void advanceOrbitsAVX2(float *angle, const float *angularSpeed, const float *distance,
+                              float *x, float *y, unsigned int n, float dt, float cx, float cy) {
+    const __m256 vdt = _mm256_set1_ps(dt);
+    const __m256 twoPi = _mm256_set1_ps(TWO_PI_F);
+    const __m256 vcx = _mm256_set1_ps(cx);
+    const __m256 vcy = _mm256_set1_ps(cy);
+
+    unsigned int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 a = _mm256_fmadd_ps(_mm256_loadu_ps(angularSpeed + i), vdt, _mm256_loadu_ps(angle + i));
+        a = _mm256_fnmadd_ps(_mm256_floor_ps(_mm256_div_ps(a, twoPi)), twoPi, a);
+        _mm256_storeu_ps(angle + i, a);
+
+        __m256 s, c;
+        sincosAVX2(a, &s, &c);
+
+        __m256 d = _mm256_loadu_ps(distance + i);
+        _mm256_storeu_ps(x + i, _mm256_fmadd_ps(c, d, vcx));
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(s, d, vcy));
+    }
+
+    advanceOrbitsScalar(angle + i, angularSpeed + i, distance + i, x + i, y + i, n - i, dt, cx, cy);
+}
+
+__attribute__((target("avx2,fma")))
+static void growPopulationsAVX2(int64_t *population, const int64_t *food, const float *capacity,
+                                unsigned int n, double growth, double decline) {
+    const __m256d vGrowth = _mm256_set1_pd(growth);
+    const __m256d vDecline = _mm256_set1_pd(decline);
+    const __m256i magicBits = _mm256_set1_epi64x(MAGIC_BITS);
+    const __m256d magicDouble = _mm256_set1_pd(MAGIC_DOUBLE);
+    const __m256i zero = _mm256_setzero_si256();
+
+    unsigned int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m256i pi = _mm256_loadu_si256((const __m256i*) (population + i));
+        __m256d p = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(pi, magicBits)), magicDouble);
+        __m256d cap = _mm256_cvtps_pd(_mm_loadu_ps(capacity + i));
+
+        __m256d noFood = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) (food + i)), zero));
+        __m256d extinct = _mm256_castsi256_pd(_mm256_cmpeq_epi64(pi, zero));
+        __m256d e = _mm256_blendv_pd(vGrowth, vDecline, noFood);
+
+        __m256d next = _mm256_div_pd(_mm256_mul_pd(cap, p), _mm256_fmadd_pd(_mm256_sub_pd(cap, p), e, p));
+        next = _mm256_round_pd(next, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        next = _mm256_andnot_pd(extinct, next);
+
+        __m256i out = _mm256_xor_si256(_mm256_castpd_si256(_mm256_add_pd(next, magicDouble)), magicBits);
+        _mm256_storeu_si256((__m256i*) (population + i), out);
+    }
+
+    growPopulationsScalar(population + i, food + i, capacity + i, n - i, growth, decline);
+}
+
+__attribute__((target("avx2,fma")))
+static double relaxRelationshipRowAVX2(float *rel, const float *x, const float *y, const float *reputation,
+                                       const float *arms, const float *weight, double *sums,
+                                       unsigned int n, const RelationshipRow &row) {
+    const __m256 xi = _mm256_set1_ps(row.x), yi = _mm256_set1_ps(row.y);
+    const __m256 repi = _mm256_set1_ps(row.reputation), armsi = _mm256_set1_ps(row.arms);
+    const __m256 relax = _mm256_set1_ps(row.relax), warm = _mm256_set1_ps(row.warm), sour = _mm256_set1_ps(row.sour);
+    const __m256 inverseRange2 = _mm256_set1_ps(row.inverseRange2);
+    const __m256 half = _mm256_set1_ps(0.5f), one = _mm256_set1_ps(1), zero = _mm256_setzero_ps();
+    const __m256 minRel = _mm256_set1_ps(MIN_PLANET_REL), maxRel = _mm256_set1_ps(MAX_PLANET_REL);
+    const __m256d weighti = _mm256_set1_pd(row.weight);
+
+    __m256d sumLo = _mm256_setzero_pd(), sumHi = _mm256_setzero_pd();
+    unsigned int k = 0;
+
+    for (; k + 8 <= n; k += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x + k), xi);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y + k), yi);
+        __m256 distance2 = _mm256_fmadd_ps(dx, dx, _mm256_mul_ps(dy, dy));
+        __m256 closeness = _mm256_max_ps(zero, _mm256_fnmadd_ps(distance2, inverseRange2, one));
+
+        __m256 r = _mm256_loadu_ps(rel + k);
+        __m256 target = _mm256_mul_ps(_mm256_add_ps(repi, _mm256_loadu_ps(reputation + k)), half);
+        r = _mm256_fmadd_ps(relax, _mm256_sub_ps(target, r), r);
+        r = _mm256_fmadd_ps(warm, closeness, r);
+        r = _mm256_fnmadd_ps(sour, _mm256_add_ps(armsi, _mm256_loadu_ps(arms + k)), r);
+        r = _mm256_min_ps(maxRel, _mm256_max_ps(minRel, r));
+        _mm256_storeu_ps(rel + k, r);
+
+        __m256 w = _mm256_loadu_ps(weight + k);
+        __m256d rLo = _mm256_cvtps_pd(_mm256_castps256_ps128(r));
+        __m256d rHi = _mm256_cvtps_pd(_mm256_extractf128_ps(r, 1));
+        sumLo = _mm256_fmadd_pd(rLo, _mm256_cvtps_pd(_mm256_castps256_ps128(w)), sumLo);
+        sumHi = _mm256_fmadd_pd(rHi, _mm256_cvtps_pd(_mm256_extractf128_ps(w, 1)), sumHi);
+
+        _mm256_storeu_pd(sums + k, _mm256_fmadd_pd(rLo, weighti, _mm256_loadu_pd(sums + k)));
+        _mm256_storeu_pd(sums + k + 4, _mm256_fmadd_pd(rHi, weighti, _mm256_loadu_pd(sums + k + 4)));
+    }
+
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(sumLo, sumHi));
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3]
+           + relaxRelationshipRowScalar(rel + k, x + k, y + k, reputation + k, arms + k,
+                                        weight + k, sums + k, n - k, row);
+}
+
+#endif // PLANET_KERNELS_X86
+
+
+/**************/
+/** Dispatch **/
+/**************/
+
+// Finds the best kernels the CPU supports.
+PlanetKernelLevel supportedPlanetKernelLevel() {
+    PlanetKernelLevel level = ScalarKernels;
+
+#ifdef PLANET_KERNELS_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        level = AVX2Kernels;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        level = SSEKernels;
+    }
+#endif
+
+    return level;
+}
+
+// Setting the environment variable SOLAR_SYSTEM_KERNELS to
+// "scalar" or "sse" caps the supported level, which is useful
+// for comparing them.
+static PlanetKernelLevel detectKernelLevel() {
+    PlanetKernelLevel level = supportedPlanetKernelLevel();
+    const char *cap = getenv("SOLAR_SYSTEM_KERNELS");
+
+    if (cap != nullptr) {
+        if (strcmp(cap, "scalar") == 0) level = ScalarKernels;
+        else if (strcmp(cap, "sse") == 0 && level > SSEKernels) level = SSEKernels;
+    }
+
+    return level;
+}
+
+static PlanetKernelLevel &kernelLevel() {
+    static PlanetKernelLevel level = detectKernelLevel();
+    return level;
+}
+
+PlanetKernelLevel planetKernelLevel() {
+    return kernelLevel();
+}
+
+bool setPlanetKernelLevel(PlanetKernelLevel level) {
+    if (level < ScalarKernels || level > supportedPlanetKernelLevel()) {
+        return false;
+    }
+
+    kernelLevel() = level;
+    return true;
+}
+
+void advanceOrbits(float *angle, const float *angularSpeed, const float *distance,
+                   float *x, float *y, unsigned int n, float dt, float cx, float cy) {
+    switch (kernelLevel()) {
+#ifdef PLANET_KERNELS_X86
+        case AVX2Kernels:
+            advanceOrbitsAVX2(angle, angularSpeed, distance, x, y, n, dt, cx, cy);
+            return;
+        case SSEKernels:
+            advanceOrbitsSSE(angle, angularSpeed, distance, x, y, n, dt, cx, cy);
+            return;
+#endif
+        default:
+            advanceOrbitsScalar(angle, angularSpeed, distance, x, y, n, dt, cx, cy);
+    }
+}
+
+void growPopulations(int64_t *population, const int64_t *food, const float *capacity,
+                     unsigned int n, double growth, double decline) {
+    switch (kernelLevel()) {
+#ifdef PLANET_KERNELS_X86
+        case AVX2Kernels:
+            growPopulationsAVX2(population, food, capacity, n, growth, decline);
+            return;
+        case SSEKernels:
+            growPopulationsSSE(population, food, capacity, n, growth, decline);
+            return;
+#endif
+        default:
+            growPopulationsScalar(population, food, capacity, n, growth, decline);
+    }
+}
+
+double relaxRelationshipRow(float *rel, const float *x, const float *y, const float *reputation,
+                            const float *arms, const float *weight, double *sums,
+                            unsigned int n, const RelationshipRow &row) {
+    switch (kernelLevel()) {
+#ifdef PLANET_KERNELS_X86
+        case AVX2Kernels:
+            return relaxRelationshipRowAVX2(rel, x, y, reputation, arms, weight, sums, n, row);
+        case SSEKernels:
+            return relaxRelationshipRowSSE(rel, x, y, reputation, arms, weight, sums, n, row);
+#endif
+        default:
+            return relaxRelationshipRowScalar(rel, x, y, reputation, arms, weight, sums, n, row);
+    }
+}
+
+const char *planetKernelLevelName(PlanetKernelLevel level) {
+    switch (level) {
+        case AVX2Kernels: return "avx2";
+        case SSEKernels: return "sse4.1";
+        case ScalarKernels: return "scalar";
+        default: return "unknown";
+    }
+}
+
+const char *planetKernelsName() {
+    return planetKernelLevelName(kernelLevel());
+}
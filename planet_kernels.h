@@ -0,0 +1,79 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_PLANET_KERNELS_H
+#define SOLAR_SYSTEM_PLANET_KERNELS_H
+
+#include <cstdint>
+
+/** Planet kernels
+ *
+ * Batch versions of the per-tick planet maths, which work on
+ * the arrays in a PlanetStore. Each one has an AVX2 and an SSE
+ * implementation as well as a plain scalar one, and the best
+ * supported by the CPU is picked the first time it's called.
+ *
+ * The levels don't agree bit for bit (AVX2 fuses multiplies and
+ * adds, the scalar kernels use libm's sin and cos, and the lanes
+ * are summed in different orders), so a run is only reproducible
+ * on the same level. Anything that needs to replay a run, like a
+ * journal, should record planetKernelLevel() and set it again.
+ */
+
+enum PlanetKernelLevel {
+    ScalarKernels,
+    SSEKernels,
+    AVX2Kernels
+};
+
+// Advances n orbits by dt seconds, keeping the angles in [0, 2pi),
+// and writes the resulting positions around (cx, cy) to x and y.
+void advanceOrbits(float *angle, const float *angularSpeed, const float *distance,
+                   float *x, float *y, unsigned int n, float dt, float cx, float cy);
+
+// Advances n populations along the logistic curve towards their
+// capacities. growth is e^(-k * dt) for planets with food, and
+// decline is the same for planets without any (where k is negated.)
+void growPopulations(int64_t *population, const int64_t *food, const float *capacity,
+                     unsigned int n, double growth, double decline);
+
+/** RelationshipRow
+ *
+ * The values shared by a whole row of the relationship graph:
+ * its planet's position, reputation, arms and influence weight,
+ * and the rates for this update.
+ */
+struct RelationshipRow {
+    float x, y, reputation, arms, weight;
+    float relax, warm, sour, inverseRange2;
+};
+
+// Moves n edges of a planet's row of the relationship graph along,
+// where rel[k] is its edge to the k-th planet after it and the other
+// arrays hold those planets' values. Each new edge times row.weight
+// is added to sums[k], and the sum of the new edges weighted by
+// weight[k] is returned.
+double relaxRelationshipRow(float *rel, const float *x, const float *y, const float *reputation,
+                            const float *arms, const float *weight, double *sums,
+                            unsigned int n, const RelationshipRow &row);
+
+// The level the kernels are using.
+PlanetKernelLevel planetKernelLevel();
+
+// The best level the CPU can run, ignoring SOLAR_SYSTEM_KERNELS.
+PlanetKernelLevel supportedPlanetKernelLevel();
+
+// Switches the kernels to the given level, returning false (and
+// leaving them alone) if the CPU can't run it. This shouldn't be
+// called while a kernel is running on another thread.
+bool setPlanetKernelLevel(PlanetKernelLevel level);
+
+// The name of a level's instruction set, e.g. "avx2".
+const char *planetKernelLevelName(PlanetKernelLevel level);
+
+// The name of the instruction set the kernels are using,
+// for benchmark output.
+const char *planetKernelsName();
+
+#endif //SOLAR_SYSTEM_PLANET_KERNELS_H
@@ -2,41 +2,93 @@
 // Created by Zac G on 14/10/2017.
 //
 
+#include <algorithm>
+
 #include "planet_relationships.h"
+#include "snapshot.h"
 
-PlanetRelationships::PlanetRelationships() {
-    relations = {};
-}
+PlanetRelationships::PlanetRelationships(): count(0), relations(nullptr) {}
 
-PlanetRelationships::PlanetRelationships(std::vector<Planet*> planets) {
-    for (int i = 0; (unsigned)i < planets.size(); i++) {
-        Planet *a = planets[i];
+PlanetRelationships::PlanetRelationships(unsigned int count):
+        count(count),
+        storage(edgeCount(count), 0),
+        relations(storage.data()) {}
 
-        for (int j = i + 1; (unsigned)j < planets.size(); j++) {
-            Planet *b = planets[j];
+PlanetRelationships::PlanetRelationships(unsigned int count, float *edges, std::shared_ptr<Snapshot> snapshot):
+        count(count),
+        snapshot(std::move(snapshot)),
+        relations(edges) {}
 
-            std::pair<Planet*, Planet*> pair(a, b);
-            relations[pair] = 0;
-        }
-    }
+uint64_t PlanetRelationships::indexOf(unsigned int a, unsigned int b) const {
+    if (a > b) std::swap(a, b);
+
+    // Row a starts after the a rows above it, which
+    // have count - 1, count - 2, ... edges each
+    return uint64_t(a) * (2 * uint64_t(count) - a - 1) / 2 + (b - a - 1);
 }
 
-float PlanetRelationships::get(Planet *a, Planet *b) {
-    std::pair<Planet*, Planet*> pair(a, b);
+float PlanetRelationships::get(unsigned int a, unsigned int b) const {
+    if (a == b) return 0;
 
-    return relations[pair];
+    return relations[indexOf(a, b)];
 }
 
-void PlanetRelationships::set(Planet *a, Planet *b, float to) {
-    std::pair<Planet*, Planet*> pair(a, b);
+float PlanetRelationships::get(Planet *a, Planet *b) const {
+    return get(a->index, b->index);
+}
+
+void PlanetRelationships::set(unsigned int a, unsigned int b, float to) {
+    if (a == b) return;
 
     if (to > MAX_PLANET_REL) to = MAX_PLANET_REL;
     if (to < MIN_PLANET_REL) to = MIN_PLANET_REL;
 
-    relations[pair] = to;
+    relations[indexOf(a, b)] = to;
 }
 
-void PlanetRelationships::shift(Planet *a, Planet *b, float delta) {
+void PlanetRelationships::set(Planet *a, Planet *b, float to) {
+    set(a->index, b->index, to);
+}
+
+void PlanetRelationships::shift(unsigned int a, unsigned int b, float delta) {
     float old = get(a, b);
     set(a, b, old + delta);
 }
+
+void PlanetRelationships::shift(Planet *a, Planet *b, float delta) {
+    shift(a->index, b->index, delta);
+}
+
+PlanetRelationships::EdgeView PlanetRelationships::edgesOf(unsigned int planet) const {
+    return EdgeView(this, planet);
+}
+
+/** EdgeView **/
+
+PlanetRelationships::EdgeView::iterator::iterator(const PlanetRelationships *graph, unsigned int planet, unsigned int other):
+        graph(graph),
+        planet(planet),
+        other(other) {
+
+    // A planet isn't related to itself
+    if (other == planet) this->other++;
+}
+
+PlanetRelationships::Edge PlanetRelationships::EdgeView::iterator::operator*() const {
+    return {other, graph->relations[graph->indexOf(planet, other)]};
+}
+
+PlanetRelationships::EdgeView::iterator &PlanetRelationships::EdgeView::iterator::operator++() {
+    other++;
+    if (other == planet) other++;
+
+    return *this;
+}
+
+PlanetRelationships::EdgeView::iterator PlanetRelationships::EdgeView::begin() const {
+    return iterator(graph, planet, 0);
+}
+
+PlanetRelationships::EdgeView::iterator PlanetRelationships::EdgeView::end() const {
+    return iterator(graph, planet, graph->count);
+}
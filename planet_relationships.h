@@ -5,33 +5,116 @@
 #ifndef SOLAR_SYSTEM_PLANET_RELATIONSHIPS_H
 #define SOLAR_SYSTEM_PLANET_RELATIONSHIPS_H
 
-#include <map>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "planet.h"
 
+class Snapshot;
+
 /** class PlanetRelationships
  *
  * Stores a graph containing the relationships
  * between each pair of planets.
+ *
+ * The graph is complete and undirected, so it's kept as the upper
+ * triangle of a matrix indexed by planet index, packed row by row
+ * into one array. 10,000 planets take just under 200MB.
+ *
+ * The array is usually owned, but a graph loaded from a snapshot
+ * uses the snapshot's array in place, keeping the snapshot mapped.
  */
 class PlanetRelationships {
+    unsigned int count;
+    std::vector<float> storage;
+    std::shared_ptr<Snapshot> snapshot;
+    float *relations;
+
+    // Where the edge between planets a and b is in relations
+    uint64_t indexOf(unsigned int a, unsigned int b) const;
+
 public:
-    std::map<std::pair<Planet*, Planet*>, float> relations;
+    /** struct Edge
+     *
+     * One of a planet's edges: the planet at the other end,
+     * and the relationship between them.
+     */
+    struct Edge {
+        unsigned int other;
+        float relationship;
+    };
+
+    /** class EdgeView
+     *
+     * Iterates over every edge of one planet, in order of
+     * the planet at the other end.
+     */
+    class EdgeView {
+        const PlanetRelationships *graph;
+        unsigned int planet;
+
+    public:
+        class iterator {
+            const PlanetRelationships *graph;
+            unsigned int planet, other;
+
+        public:
+            iterator(const PlanetRelationships *graph, unsigned int planet, unsigned int other);
+
+            Edge operator*() const;
+            iterator &operator++();
+            bool operator!=(const iterator &it) const { return other != it.other; }
+        };
+
+        EdgeView(const PlanetRelationships *graph, unsigned int planet): graph(graph), planet(planet) {}
+
+        iterator begin() const;
+        iterator end() const;
+    };
 
     PlanetRelationships();
 
-    // Initialise all graph edges to 0
-    explicit PlanetRelationships(std::vector<Planet*> planets);
+    // Initialise all graph edges between the given
+    // number of planets to 0
+    explicit PlanetRelationships(unsigned int count);
+
+    // Uses the edges between the given number of planets which
+    // are already in a snapshot, without copying them
+    PlanetRelationships(unsigned int count, float *edges, std::shared_ptr<Snapshot>);
+
+    // The graph may point into its own storage
+    PlanetRelationships(const PlanetRelationships&) = delete;
+    PlanetRelationships &operator=(const PlanetRelationships&) = delete;
+
+    unsigned int size() const { return count; }
+
+    // The number of edges, for a graph between the given number of planets
+    static uint64_t edgeCount(unsigned int count) { return uint64_t(count) * (count - (count > 0)) / 2; }
+
+    // Gets every edge, packed row by row
+    const float *edges() const { return relations; }
+
+    // Gets the edges (a, b) for every b > a, which are contiguous.
+    // Writes through this aren't clamped.
+    float *row(unsigned int a) { return relations + indexOf(a, a + 1); }
+    const float *row(unsigned int a) const { return relations + indexOf(a, a + 1); }
 
     // Gets the relationship between two planets
-    float get(Planet*, Planet*);
+    float get(unsigned int a, unsigned int b) const;
+    float get(Planet*, Planet*) const;
 
     // Sets the relationship between two planets
+    void set(unsigned int a, unsigned int b, float);
     void set(Planet*, Planet*, float);
 
     // Adds a number to the relationship between two planets.
     // Equivalent rel[a, b] += ∂
+    void shift(unsigned int a, unsigned int b, float delta);
     void shift(Planet*, Planet*, float delta);
+
+    // Gets the edges of the given planet
+    EdgeView edgesOf(unsigned int planet) const;
 };
 
 #endif //SOLAR_SYSTEM_PLANET_RELATIONSHIPS_H
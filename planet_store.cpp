@@ -0,0 +1,242 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include "planet_store.h"
+#include "planet_kernels.h"
+#include "random.h"
+
+// The caps on each planet's resources
+const int64_t foodCap = 50000;
+const int64_t farmersCap = 5000000;
+const int64_t metalCap = 50000000;
+const int64_t woodCap = 50000000;
+const int64_t waterCap = 50000000;
+const int64_t speciesCap = 500000;
+
+// The number of planets to generate jitter for at once
+#define JITTER_BATCH 256
+
+// The per-tick resource drift is uniform over [-500, 10000),
+// with this mean and variance
+#define DRIFT_MEAN 4749.5
+#define DRIFT_VARIANCE ((10500.0 * 10500.0 - 1) / 12)
+
+unsigned int PlanetStore::add() {
+    unsigned int index = size();
+    resize(index + 1);
+
+    return index;
+}
+
+void PlanetStore::resize(unsigned int n) {
+    angle.resize(n);
+    speed.resize(n);
+    angularSpeed.resize(n);
+    distanceFromSun.resize(n);
+    capacity.resize(n);
+    biodiversity.resize(n);
+    pixelRadius.resize(n);
+    x.resize(n);
+    y.resize(n);
+
+    for (auto &counts : resources) counts.resize(n);
+    for (auto &counts : versions) counts.resize(n);
+}
+
+void PlanetStore::clear() {
+    angle.clear();
+    speed.clear();
+    angularSpeed.clear();
+    distanceFromSun.clear();
+    capacity.clear();
+    biodiversity.clear();
+    pixelRadius.clear();
+    x.clear();
+    y.clear();
+
+    for (auto &counts : resources) counts.clear();
+    for (auto &counts : versions) counts.clear();
+}
+
+unsigned int PlanetStore::size() const {
+    return angle.size();
+}
+
+Resources PlanetStore::getResources(unsigned int i) const {
+    Resources res;
+
+    for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+        res.store[type] = resources[type][i];
+    }
+
+    return res;
+}
+
+void PlanetStore::setResources(unsigned int i, const Resources &res) {
+    for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+        setResource(i, ResourceType(type), res.store[type]);
+    }
+}
+
+void PlanetStore::setResource(unsigned int i, ResourceType type, int64_t count) {
+    if (resources[type][i] == count) return;
+
+    resources[type][i] = count;
+    versions[type][i]++;
+}
+
+void PlanetStore::update(float dt, float cx, float cy) {
+    unsigned int n = size();
+
+    advanceOrbits(angle.data(), angularSpeed.data(), distanceFromSun.data(),
+                  x.data(), y.data(), n, dt, cx, cy);
+
+    // TODO have people die off if there's not enough food
+    // Population uses a logistic model, with a relative growth
+    // rate of 0.1, or -0.1 when there's a shortage of food. The
+    // exponentials are the same for every planet.
+    double k = 0.1;
+    double growth = std::exp(-k * dt), decline = std::exp(k * dt);
+
+    int64_t *population = resources[Population].data();
+    int64_t *food = resources[Food].data();
+    int64_t *species = resources[Species].data();
+    int64_t *metal = resources[Metal].data();
+    int64_t *wood = resources[Wood].data();
+    int64_t *water = resources[Water].data();
+    int64_t *weaponary = resources[Weaponary].data();
+
+    // The random jitter for each planet is keyed by (seed, planet, tick),
+    // and generated a batch at a time.
+    uint32_t jitter[JITTER_BATCH][4], arms[JITTER_BATCH][4];
+
+    // Each batch's counts from before the tick, to see which changed
+    int64_t before[NUM_RESOURCE_TYPES][JITTER_BATCH];
+
+    for (unsigned int first = 0; first < n; first += JITTER_BATCH) {
+        unsigned int count = std::min(n - first, (unsigned int) JITTER_BATCH);
+
+        for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+            std::copy_n(resources[type].data() + first, count, before[type]);
+        }
+
+        growPopulations(population + first, food + first, capacity.data() + first,
+                        count, growth, decline);
+
+        fillRandomBlocks(seed, tick, first, count, JitterStream, jitter);
+        fillRandomBlocks(seed, tick, first, count, WeaponaryStream, arms);
+
+        for (unsigned int j = 0; j < count; j++) {
+            unsigned int i = first + j;
+
+            // TODO: would like to implement people management ex. # of framers, scientists, engineers,
+            // laborers and resource production would be based of this
+            int64_t number_of_farmers = std::min(population[i], farmersCap);
+
+            // Update others resources stats, each by a random amount from -500 to 10000
+            species[i] += randomSpan(jitter[j][0], -500, 10500);
+            metal[i] += randomSpan(jitter[j][1], -500, 10500);
+            wood[i] += randomSpan(jitter[j][2], -500, 10500);
+            water[i] += randomSpan(jitter[j][3], -500, 10500);
+
+            // If there's no people their shouldn't be any weapons
+            if (population[i] > 0) {
+                weaponary[i] = randomSpan(arms[j][0], 0, 10000);
+            }
+
+            // Each farmer on the planet can grow food equal to the bio diversity of the planet, however each person must eats one
+            if (!population[i]) { // No farmers, no food
+                food[i] = 0;
+            } else {
+                food[i] = int64_t((number_of_farmers * biodiversity[i]) / std::sqrt(population[i]));
+            }
+
+            // Cap on all resources
+            species[i] = std::min(speciesCap, std::max(int64_t(0), species[i]));
+            metal[i] = std::min(metalCap, std::max(int64_t(0), metal[i]));
+            wood[i] = std::min(woodCap, std::max(int64_t(0), wood[i]));
+            water[i] = std::min(waterCap, std::max(int64_t(0), water[i]));
+            food[i] = std::min(foodCap, std::max(int64_t(0), food[i]));
+        }
+
+        for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+            const int64_t *counts = resources[type].data() + first;
+            uint32_t *version = versions[type].data() + first;
+
+            for (unsigned int j = 0; j < count; j++) {
+                version[j] += counts[j] != before[type][j];
+            }
+        }
+    }
+
+    tick++;
+}
+
+void PlanetStore::fastForward(uint64_t ticks, float dt, float cx, float cy) {
+    unsigned int n = size();
+    double duration = double(ticks) * dt;
+
+    // Each orbit has a constant angular speed, so only the
+    // remainder of a full turn matters. The kernel does the
+    // rest of the wrapping and the positions.
+    for (unsigned int i = 0; i < n; i++) {
+        angle[i] = float(angle[i] + std::fmod(double(angularSpeed[i]) * duration, 2 * M_PI));
+    }
+
+    advanceOrbits(angle.data(), angularSpeed.data(), distanceFromSun.data(),
+                  x.data(), y.data(), n, 0, cx, cy);
+
+    // Composing logistic steps gives the logistic curve, so the
+    // population can jump straight to its value after the whole
+    // duration. An inhabited planet always grows some food, so
+    // the shortage branch doesn't apply over a long stretch.
+    double growth = std::exp(-0.1 * duration);
+    growPopulations(resources[Population].data(), resources[Food].data(), capacity.data(),
+                    n, growth, growth);
+
+    // The sum of the per-tick drift is approximately normal. It's
+    // then clamped like a tick would, which leaves the planets which
+    // reach a cap sitting exactly on it. Stepping a few ticks after
+    // this spreads them out below the cap again.
+    double mean = ticks * DRIFT_MEAN;
+    double deviation = std::sqrt(ticks * DRIFT_VARIANCE);
+
+    ResourceType drifting[] = {Species, Metal, Wood, Water};
+    int64_t caps[] = {speciesCap, metalCap, woodCap, waterCap};
+
+    for (unsigned int i = 0; i < n; i++) {
+        // Count up from the current tick, so that each jump differs
+        Random random(seed, i, FastForwardStream, tick);
+
+        for (int r = 0; r < 4; r++) {
+            int64_t &count = resources[drifting[r]][i];
+            double next = count + mean + deviation * random.normal();
+
+            count = int64_t(std::min(double(caps[r]), std::max(0.0, next)));
+        }
+
+        int64_t *population = &resources[Population][i];
+
+        if (*population == 0) {
+            resources[Food][i] = 0;
+        } else {
+            int64_t farmers = std::min(*population, farmersCap);
+            int64_t food = int64_t((farmers * biodiversity[i]) / std::sqrt(*population));
+            resources[Food][i] = std::min(foodCap, std::max(int64_t(0), food));
+
+            // Only planets with people rearm, like in update()
+            resources[Weaponary][i] = randomSpan(random.next(), 0, 10000);
+        }
+    }
+
+    // Almost everything will have changed
+    for (auto &counts : versions) {
+        for (auto &version : counts) version++;
+    }
+
+    tick += ticks;
+}
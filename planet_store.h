@@ -0,0 +1,78 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_PLANET_STORE_H
+#define SOLAR_SYSTEM_PLANET_STORE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "resource.h"
+
+/** class PlanetStore
+ *
+ * Stores the simulation state of every planet as parallel
+ * arrays, indexed by Planet::index. Only the fields touched
+ * every tick live here, so updating all the planets streams
+ * through contiguous memory instead of striding over names
+ * and SFML shapes.
+ */
+class PlanetStore {
+public:
+    // The world seed, which all of the resource jitter is derived
+    // from, and the number of updates so far.
+    uint64_t seed = 0;
+    uint64_t tick = 0;
+
+    std::vector<float> angle;           // radians, in [0, 2pi)
+    std::vector<float> speed;           // px/s
+    std::vector<float> angularSpeed;    // radians/s, calculated from speed and distanceFromSun
+    std::vector<float> distanceFromSun; // px
+    std::vector<float> capacity;
+    std::vector<float> biodiversity;
+    std::vector<float> pixelRadius;     // px
+
+    // The positions, as of the last update
+    std::vector<float> x, y;
+
+    // The resource counts, with one array per ResourceType
+    std::vector<int64_t> resources[NUM_RESOURCE_TYPES];
+
+    // A counter for each resource count, bumped whenever the
+    // count changes, so the UI can tell what needs redrawing
+    std::vector<uint32_t> versions[NUM_RESOURCE_TYPES];
+
+    // Appends a zeroed planet, returning its index
+    unsigned int add();
+
+    // Grows (with zeroed planets) or shrinks the store to n planets.
+    // Planets can then be filled in at their indices, from any thread.
+    void resize(unsigned int n);
+
+    // Removes every planet
+    void clear();
+
+    // The number of planets stored
+    unsigned int size() const;
+
+    // Gathers/scatters a planet's resource counts
+    Resources getResources(unsigned int) const;
+    void setResources(unsigned int, const Resources&);
+
+    // Sets one of a planet's resource counts
+    void setResource(unsigned int, ResourceType, int64_t);
+
+    // Advances every planet's orbit and resources by dt seconds,
+    // positioning them around (cx, cy).
+    void update(float dt, float cx, float cy);
+
+    // Jumps every planet forward by the given number of ticks of dt
+    // seconds, in one go. Orbits and populations are moved along
+    // their closed forms, and the random resource drift is replaced
+    // by a draw from its aggregate (normal) distribution. Weaponary
+    // is redrawn every tick, so it just gets one more draw.
+    void fastForward(uint64_t ticks, float dt, float cx, float cy);
+};
+
+#endif //SOLAR_SYSTEM_PLANET_STORE_H
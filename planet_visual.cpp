@@ -0,0 +1,47 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include "planet_visual.h"
+
+PlanetVisual::PlanetVisual(Planet &planet) {
+    float pixRadius = planet.getPixelRadius();
+    shape = sf::CircleShape(pixRadius);
+    shape.setFillColor(planet.colour);
+    shape.setOrigin(pixRadius, pixRadius);
+
+    float distanceFromSun = planet.getDistanceFromSun();
+    orbit = sf::CircleShape(distanceFromSun, 100);
+    orbit.setFillColor(sf::Color::Transparent);
+    orbit.setOutlineColor(sf::Color(ORBIT_COLOUR));
+    orbit.setOutlineThickness(N(2));
+    orbit.setPosition(SYSTEM_X, SYSTEM_Y);
+    orbit.setOrigin(distanceFromSun, distanceFromSun);
+
+    float borderPixRadius = planet.getBorderPixelRadius();
+    border = sf::CircleShape(borderPixRadius);
+    border.setFillColor(sf::Color::Transparent);
+    border.setOutlineColor(planet.colour);
+    border.setOutlineThickness(PLANET_BORDER_THICKNESS);
+    border.setOrigin(borderPixRadius, borderPixRadius);
+
+    update(planet);
+}
+
+void PlanetVisual::update(Planet &planet) {
+    sf::Vector2f position = planet.getPosition();
+    shape.setPosition(position);
+    border.setPosition(position);
+}
+
+void PlanetVisual::render(sf::RenderWindow *win) {
+    win->draw(shape);
+}
+
+void PlanetVisual::renderOrbit(sf::RenderTarget *win) {
+    win->draw(orbit);
+}
+
+void PlanetVisual::renderBorder(sf::RenderWindow *win) {
+    win->draw(border);
+}
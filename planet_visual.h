@@ -0,0 +1,34 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_PLANET_VISUAL_H
+#define SOLAR_SYSTEM_PLANET_VISUAL_H
+
+#include <SFML/Graphics.hpp>
+
+#include "planet.h"
+
+/** class PlanetVisual
+ *
+ * The shapes used to draw a planet. These are kept apart
+ * from the planet's simulation state, and are only created
+ * when there's a window to draw them on.
+ */
+class PlanetVisual {
+    sf::CircleShape shape;
+    sf::CircleShape orbit;
+    sf::CircleShape border;
+
+public:
+    explicit PlanetVisual(Planet&);
+
+    // Moves the shapes to the planet's current position
+    void update(Planet&);
+
+    void render(sf::RenderWindow*);
+    void renderOrbit(sf::RenderTarget*);
+    void renderBorder(sf::RenderWindow*);
+};
+
+#endif //SOLAR_SYSTEM_PLANET_VISUAL_H
@@ -0,0 +1,78 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <cmath>
+
+#include "random.h"
+
+// The Philox4x32 multipliers and Weyl sequence constants
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+void philox(uint64_t seed, uint64_t counter, uint32_t entity, uint32_t stream, uint32_t out[4]) {
+    uint32_t c0 = uint32_t(counter), c1 = uint32_t(counter >> 32), c2 = entity, c3 = stream;
+    uint32_t k0 = uint32_t(seed), k1 = uint32_t(seed >> 32);
+
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        uint64_t p0 = uint64_t(PHILOX_M0) * c0;
+        uint64_t p1 = uint64_t(PHILOX_M1) * c2;
+
+        c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        c1 = uint32_t(p1);
+        c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c3 = uint32_t(p0);
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+void fillRandomBlocks(uint64_t seed, uint64_t counter, uint32_t first, uint32_t count,
+                      uint32_t stream, uint32_t (*blocks)[4]) {
+    for (uint32_t i = 0; i < count; i++) {
+        philox(seed, counter, first + i, stream, blocks[i]);
+    }
+}
+
+Random::Random(uint64_t seed, uint32_t entity, uint32_t stream, uint64_t counter):
+        seed(seed), entity(entity), stream(stream), counter(counter), used(4) {}
+
+uint32_t Random::next() {
+    // Generate the next block once the last one is used up
+    if (used == 4) {
+        philox(seed, counter++, entity, stream, block);
+        used = 0;
+    }
+
+    return block[used++];
+}
+
+float Random::uniform() {
+    // The top 24 bits fit exactly into a float's mantissa
+    return (next() >> 8) * (1.f / 16777216.f);
+}
+
+float Random::range(float min, float max) {
+    return min + uniform() * (max - min);
+}
+
+uint32_t Random::below(uint32_t n) {
+    return uint32_t((uint64_t(next()) * n) >> 32);
+}
+
+double Random::normal() {
+    // Box-Muller transform. u is in (0, 1], so the log is finite.
+    double u = (next() + 1.0) / 4294967296.0;
+    double v = next() / 4294967296.0;
+
+    return std::sqrt(-2 * std::log(u)) * std::cos(2 * M_PI * v);
+}
@@ -0,0 +1,75 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_RANDOM_H
+#define SOLAR_SYSTEM_RANDOM_H
+
+#include <cstdint>
+
+/** RandomStream
+ *
+ * Separates the random numbers used for different purposes,
+ * so that e.g. generating a planet can never correlate with
+ * its resource jitter.
+ */
+enum RandomStream : uint32_t {
+    JitterStream = 0,
+    WeaponaryStream = 1,
+    FastForwardStream = 2,
+    InhabitedStream = 3,
+    NameStream = 4,
+    GenerationStream = 0x100
+};
+
+// Philox4x32-10, a counter-based random number generator. Every
+// (seed, counter, entity, stream) gives four independent random
+// words, with no state carried from one call to the next, so any
+// entity's numbers can be generated in any order (or in parallel.)
+void philox(uint64_t seed, uint64_t counter, uint32_t entity, uint32_t stream, uint32_t out[4]);
+
+// Fills blocks with the random words for count consecutive entities,
+// starting at first, at the given counter (usually the tick.)
+void fillRandomBlocks(uint64_t seed, uint64_t counter, uint32_t first, uint32_t count,
+                      uint32_t stream, uint32_t (*blocks)[4]);
+
+// Maps a random word to an integer in [min, min + span)
+inline int64_t randomSpan(uint32_t word, int64_t min, uint32_t span) {
+    return min + int64_t((uint64_t(word) * span) >> 32);
+}
+
+/** class Random
+ *
+ * A sequence of random numbers belonging to a single entity,
+ * e.g. the numbers used to generate one planet. It's a thin
+ * wrapper around philox which counts up from a starting point.
+ */
+class Random {
+    uint64_t seed;
+    uint32_t entity, stream;
+
+    uint64_t counter;
+    uint32_t block[4];
+    int used;
+
+public:
+    // The counter starts at 0, unless specified
+    Random(uint64_t seed, uint32_t entity, uint32_t stream, uint64_t counter = 0);
+
+    // A uniformly distributed 32 bit word
+    uint32_t next();
+
+    // A float in [0, 1)
+    float uniform();
+
+    // A float in [min, max)
+    float range(float min, float max);
+
+    // An integer in [0, n)
+    uint32_t below(uint32_t n);
+
+    // A normally distributed double, with mean 0 and variance 1
+    double normal();
+};
+
+#endif //SOLAR_SYSTEM_RANDOM_H
@@ -0,0 +1,169 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include "config.h"
+#include "planet_kernels.h"
+#include "relationship_dynamics.h"
+
+RelationshipDynamics::RelationshipDynamics(): nextBlock(0) {
+    threads = std::max(1u, std::min(std::thread::hardware_concurrency(), unsigned(REL_BLOCKS)));
+}
+
+RelationshipDynamics::~RelationshipDynamics() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    wake.notify_all();
+
+    for (auto &worker : workers) worker.join();
+}
+
+unsigned int RelationshipDynamics::blockCount(unsigned int n) {
+    return n < REL_PARALLEL_MIN_PLANETS ? 1 : REL_BLOCKS;
+}
+
+void RelationshipDynamics::recordTrade(unsigned int sender, unsigned int destination, const Resources &cargo) {
+    int64_t total = 0;
+    for (int type = 0; type < NUM_RESOURCE_TYPES; type++) total += cargo.store[type];
+
+    trades.push_back({sender, destination, REL_TRADE_BONUS * total / MAX_CARGO_PER_RESOURCE});
+}
+
+void RelationshipDynamics::forEachBlock(unsigned int n, const std::function<void(unsigned int, unsigned int, unsigned int)> &fn) {
+    unsigned int count = blockCount(n);
+
+    // Row i has n - 1 - i edges, so the early rows are the
+    // longest. Start a new block every 1/count of the edges.
+    if (blocks.size() != count + 1 || blocks.back() != n) {
+        blocks.assign(1, 0);
+
+        double total = double(n) * (n - 1) / 2, edges = 0;
+
+        for (unsigned int i = 0; i < n && blocks.size() < count; i++) {
+            edges += n - 1 - i;
+            if (edges >= total * blocks.size() / count) blocks.push_back(i + 1);
+        }
+
+        while (blocks.size() <= count) blocks.push_back(n);
+    }
+
+    if (count == 1) {
+        fn(0, n, 0);
+        return;
+    }
+
+    while (workers.size() + 1 < threads) {
+        workers.emplace_back(&RelationshipDynamics::work, this, round);
+    }
+
+    // Start a round, work on it alongside the workers,
+    // and wait for them all to finish it
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &fn;
+        jobBlocks = count;
+        nextBlock = 0;
+        busy = workers.size();
+        round++;
+    }
+
+    wake.notify_all();
+    runBlocks();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&]() { return busy == 0; });
+    job = nullptr;
+}
+
+void RelationshipDynamics::runBlocks() {
+    // Each block writes to its own sums, so which thread
+    // runs it doesn't change the result
+    for (unsigned int b = nextBlock++; b < jobBlocks; b = nextBlock++) {
+        (*job)(blocks[b], blocks[b + 1], b);
+    }
+}
+
+void RelationshipDynamics::work(uint64_t seen) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wake.wait(lock, [&]() { return stopping || round != seen; });
+        if (stopping) return;
+
+        seen = round;
+
+        lock.unlock();
+        runBlocks();
+        lock.lock();
+
+        if (--busy == 0) finished.notify_one();
+    }
+}
+
+void RelationshipDynamics::update(PlanetRelationships &relationships, const PlanetStore &store, float dt) {
+    unsigned int n = relationships.size();
+
+    for (auto &trade : trades) {
+        relationships.shift(trade.sender, trade.destination, trade.amount);
+    }
+
+    trades.clear();
+
+    if (n < 2) return;
+
+    const int64_t *weaponary = store.resources[Weaponary].data();
+
+    influence.resize(n);
+    arms.resize(n);
+    reputation.resize(n, 0);
+
+    double totalInfluence = 0;
+
+    for (unsigned int i = 0; i < n; i++) {
+        arms[i] = std::min(1.f, float(weaponary[i]) / MAX_WEAPONARY);
+        influence[i] = 1 + arms[i];
+        totalInfluence += influence[i];
+    }
+
+    // Move every edge along, using the reputations from the last
+    // update. The relaxation is exact for any dt, so it can't
+    // overshoot. In the same pass, sum each planet's new influence-
+    // weighted relationships for the next update's reputations.
+    // The graph is symmetric, so each edge adds to both ends: each
+    // thread walks its own rows and keeps its own sums.
+    float relax = 1 - std::exp(-REL_DIFFUSION_RATE * dt);
+    float warm = REL_PROXIMITY_RATE * dt, sour = REL_WEAPONARY_RATE * dt / 2;
+    float inverseRange2 = 1 / (REL_PROXIMITY_RANGE * REL_PROXIMITY_RANGE);
+
+    const float *x = store.x.data(), *y = store.y.data();
+    const float *rep = reputation.data(), *arm = arms.data(), *weight = influence.data();
+
+    unsigned int count = blockCount(n);
+    partial.assign(size_t(count) * n, 0);
+
+    forEachBlock(n, [&](unsigned int first, unsigned int last, unsigned int block) {
+        double *sums = partial.data() + size_t(block) * n;
+
+        for (unsigned int i = first; i < last; i++) {
+            RelationshipRow row = {x[i], y[i], rep[i], arm[i], weight[i], relax, warm, sour, inverseRange2};
+
+            // The planets after i line up with its row
+            unsigned int j = i + 1;
+            sums[i] += relaxRelationshipRow(relationships.row(i), x + j, y + j, rep + j, arm + j,
+                                            weight + j, sums + j, n - j, row);
+        }
+    });
+
+    for (unsigned int i = 0; i < n; i++) {
+        double sum = 0;
+        for (unsigned int b = 0; b < count; b++) sum += partial[size_t(b) * n + i];
+
+        reputation[i] = float(sum / (totalInfluence - influence[i]));
+    }
+}
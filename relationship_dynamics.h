@@ -0,0 +1,112 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_RELATIONSHIP_DYNAMICS_H
+#define SOLAR_SYSTEM_RELATIONSHIP_DYNAMICS_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "planet_relationships.h"
+#include "planet_store.h"
+#include "resource.h"
+
+/** class RelationshipDynamics
+ *
+ * Evolves the relationships between planets every tick:
+ *
+ *  - Delivered ships improve the relationship between
+ *    their sender and destination.
+ *  - Planets which orbit close to each other slowly warm.
+ *  - Armed planets sour all of their relationships.
+ *  - Each planet has a reputation, which is how every other
+ *    planet feels about it, weighted by how armed they are.
+ *    Every relationship relaxes towards the average of its
+ *    two planets' reputations, so influence spreads through
+ *    the graph.
+ *
+ * The reputations are a matrix-vector product over the graph,
+ * worked out alongside the edge updates, so they lag by one
+ * update. With enough planets, the rows are split into a fixed
+ * number of blocks, which the threads take turns to pick up.
+ * The threads are started the first time they're needed and
+ * then kept, since an update can run thousands of times a frame.
+ */
+class RelationshipDynamics {
+    // A delivery waiting to be applied on the next update
+    struct Trade {
+        unsigned int sender, destination;
+        float amount;
+    };
+
+    std::vector<Trade> trades;
+
+    // Per-planet state: how much weight each planet's opinions
+    // carry, how armed it is and its reputation as of the last
+    // update
+    std::vector<float> influence, arms, reputation;
+
+    // Each block's share of the reputation sums
+    std::vector<double> partial;
+
+    // The rows each block starts at, for the current
+    // number of planets
+    std::vector<unsigned int> blocks;
+    unsigned int threads;
+
+    // The threads other than the updating one, which wait for
+    // each round of blocks. A round's function and block count
+    // are only changed while no worker is busy.
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake, finished;
+    const std::function<void(unsigned int, unsigned int, unsigned int)> *job = nullptr;
+    unsigned int jobBlocks = 0, busy = 0;
+    uint64_t round = 0;
+    bool stopping = false;
+
+    // The next block of the current round to be picked up
+    std::atomic<unsigned int> nextBlock;
+
+    // Picks up blocks of the current round until there are none left
+    void runBlocks();
+
+    // Each worker's loop, which runs a share of every round
+    // after the given one
+    void work(uint64_t seen);
+
+    // The number of blocks an n-planet graph is split into
+    static unsigned int blockCount(unsigned int n);
+
+    // Splits the rows of an n-planet graph into blocks with about
+    // the same number of edges, and calls fn(first, last, block)
+    // for each, spread over the threads if there's more than one.
+    void forEachBlock(unsigned int n, const std::function<void(unsigned int, unsigned int, unsigned int)> &fn);
+
+public:
+    RelationshipDynamics();
+    ~RelationshipDynamics();
+
+    RelationshipDynamics(const RelationshipDynamics&) = delete;
+    RelationshipDynamics &operator=(const RelationshipDynamics&) = delete;
+
+    // Records a ship's delivery from sender to destination
+    void recordTrade(unsigned int sender, unsigned int destination, const Resources&);
+
+    // Advances every relationship by dt seconds, using the
+    // planets' current positions and weaponary. Large steps
+    // are fine; the relaxation never overshoots.
+    void update(PlanetRelationships&, const PlanetStore&, float dt);
+
+    // Gets/sets the reputations as of the last update, which the
+    // next update carries on from. They're empty before the first.
+    const std::vector<float> &getReputations() const { return reputation; }
+    void setReputations(const float *reputations, unsigned int n) { reputation.assign(reputations, reputations + n); }
+};
+
+#endif //SOLAR_SYSTEM_RELATIONSHIP_DYNAMICS_H
@@ -4,48 +4,66 @@
 
 #include "resource.h"
 
-Resources::Resources() {
-    // Initialise all possible store fields
-    store = {
-            {Metal, 0},
-            {Wood, 0},
-            {Water, 0},
-            {Population, 0},
-            {Species, 0},
-            {Food, 0},
-            {Weaponary, 0}
-    };
-}
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+Resources::Resources(): store() {}
 
 // Returns the sum of two resources
-Resources Resources::operator+(Resources other) {
+Resources Resources::operator+(const Resources &other) const {
     Resources cp;
 
-    for (auto &iter : store) {
-        cp.store[iter.first] = iter.second + other.store[iter.first];
+#ifdef __SSE2__
+    for (int i = 0; i < NUM_RESOURCE_SLOTS; i += 2) {
+        __m128i a = _mm_load_si128((const __m128i*) &store[i]);
+        __m128i b = _mm_load_si128((const __m128i*) &other.store[i]);
+        _mm_store_si128((__m128i*) &cp.store[i], _mm_add_epi64(a, b));
     }
+#else
+    for (int i = 0; i < NUM_RESOURCE_SLOTS; i++) cp.store[i] = store[i] + other.store[i];
+#endif
 
     return cp;
 }
 
 // Returns the left resource minus the right, i.e. for every resource
 // type, result[t] = left[t] - right[t]
-Resources Resources::operator-(Resources other) {
+Resources Resources::operator-(const Resources &other) const {
     Resources cp;
 
-    for (auto &iter : store) {
-        cp.store[iter.first] = iter.second - other.store[iter.first];
+#ifdef __SSE2__
+    for (int i = 0; i < NUM_RESOURCE_SLOTS; i += 2) {
+        __m128i a = _mm_load_si128((const __m128i*) &store[i]);
+        __m128i b = _mm_load_si128((const __m128i*) &other.store[i]);
+        _mm_store_si128((__m128i*) &cp.store[i], _mm_sub_epi64(a, b));
     }
+#else
+    for (int i = 0; i < NUM_RESOURCE_SLOTS; i++) cp.store[i] = store[i] - other.store[i];
+#endif
 
     return cp;
 }
 
-bool Resources::operator>(Resources other) {
-    for (auto &iter : store) {
-        int otherVal = other.store[iter.first];
+bool Resources::operator>(const Resources &other) const {
+#ifdef __SSE2__
+    // SSE2 can't compare 64-bit integers, but the counts are nowhere
+    // near overflowing, so other > this exactly when this - other is
+    // negative. Gather the sign bits of the differences.
+    int negative = 0;
+
+    for (int i = 0; i < NUM_RESOURCE_SLOTS; i += 2) {
+        __m128i a = _mm_load_si128((const __m128i*) &store[i]);
+        __m128i b = _mm_load_si128((const __m128i*) &other.store[i]);
+        negative |= _mm_movemask_pd(_mm_castsi128_pd(_mm_sub_epi64(a, b)));
+    }
 
-        if (otherVal > iter.second) return false;
+    return negative == 0;
+#else
+    for (int i = 0; i < NUM_RESOURCE_TYPES; i++) {
+        if (other.store[i] > store[i]) return false;
     }
 
     return true;
+#endif
 }
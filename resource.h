@@ -5,7 +5,7 @@
 #ifndef SOLAR_SYSTEM_RESOURCE_H
 #define SOLAR_SYSTEM_RESOURCE_H
 
-#include <map>
+#include <cstdint>
 
 /** ResourceType
  *
@@ -21,24 +21,31 @@ enum ResourceType {
     Weaponary
 };
 
-typedef std::map<ResourceType, long> Store;
+// The number of resource types
+const int NUM_RESOURCE_TYPES = Weaponary + 1;
+
+// The resource counts are padded to an even number, so
+// they can be worked on two at a time
+const int NUM_RESOURCE_SLOTS = (NUM_RESOURCE_TYPES + 1) & ~1;
 
 /** Resources
  *
- * Contains a Store (std::map<ResourceType, int>) and
- * some useful operators.
+ * An amount of each type of resource, stored in a fixed
+ * array indexed by ResourceType, and some useful operators.
  */
 class Resources {
 public:
-    Store store;
+    // The count of each resource, e.g. store[Metal]. The
+    // padding at the end is always 0.
+    alignas(16) int64_t store[NUM_RESOURCE_SLOTS];
 
     Resources();
-    Resources operator+(Resources);
-    Resources operator-(Resources);
+    Resources operator+(const Resources&) const;
+    Resources operator-(const Resources&) const;
 
     // Checks if the given resources could be removed from this,
     // to still have >= 0 resources for each type.
-    bool operator>(Resources);
+    bool operator>(const Resources&) const;
 };
 
 #endif //SOLAR_SYSTEM_RESOURCE_H
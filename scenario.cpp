@@ -0,0 +1,108 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "scenario.h"
+
+Scenario Scenario::current;
+
+// Parses the whole of text as a number, into out
+static bool parse(const std::string &text, int64_t &out) {
+    char *end;
+    errno = 0;
+    out = strtoll(text.c_str(), &end, 10);
+    return !text.empty() && *end == '\0' && errno == 0;
+}
+
+static bool parse(const std::string &text, int &out) {
+    int64_t value;
+    if (!parse(text, value) || value < INT_MIN || value > INT_MAX) return false;
+
+    out = int(value);
+    return true;
+}
+
+static bool parse(const std::string &text, float &out) {
+    char *end;
+    errno = 0;
+    out = strtof(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && errno == 0;
+}
+
+// Strips the whitespace from both ends of a string
+static std::string trim(const std::string &text) {
+    size_t start = text.find_first_not_of(" \t\r");
+    if (start == std::string::npos) return "";
+
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(start, end - start + 1);
+}
+
+bool Scenario::set(const std::string &key, const std::string &value) {
+    if (key == "planets") return parse(value, numPlanets);
+    if (key == "min_inhabited") return parse(value, minInhabited);
+    if (key == "max_inhabited") return parse(value, maxInhabited);
+    if (key == "min_population") return parse(value, minPopulation);
+    if (key == "max_population") return parse(value, maxPopulation);
+    if (key == "min_planet_speed") return parse(value, minPlanetSpeed);
+    if (key == "max_planet_speed") return parse(value, maxPlanetSpeed);
+    if (key == "max_cargo") return parse(value, maxCargoPerResource);
+    if (key == "timescale") return parse(value, timescale);
+
+    return false;
+}
+
+bool Scenario::load(const std::string &path) {
+    std::ifstream file(path);
+
+    if (!file) {
+        std::cerr << "Couldn't open the scenario " << path << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int number = 0;
+
+    while (std::getline(file, line)) {
+        number++;
+
+        line = trim(line);
+        if (line.empty() || line[0] == '#') continue;
+
+        size_t equals = line.find('=');
+
+        if (equals == std::string::npos || !set(trim(line.substr(0, equals)), trim(line.substr(equals + 1)))) {
+            std::cerr << path << ":" << number << ": invalid setting \"" << line << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Scenario::validate() const {
+    const char *problem = nullptr;
+
+    if (numPlanets < 1) {
+        problem = "there must be at least one planet";
+    } else if (minInhabited < 0 || minInhabited > maxInhabited || maxInhabited > numPlanets) {
+        problem = "the inhabited planets must be from 0 to the number of planets, with min <= max";
+    } else if (minPopulation < 1 || minPopulation > maxPopulation) {
+        problem = "the population bounds must be positive, with min <= max";
+    } else if (minPlanetSpeed <= 0 || minPlanetSpeed > maxPlanetSpeed) {
+        problem = "the planet speed bounds must be positive, with min <= max";
+    } else if (maxCargoPerResource < 1) {
+        problem = "ships must be able to carry some cargo";
+    } else if (timescale < 1) {
+        problem = "the timescale must be at least a minute";
+    }
+
+    if (problem != nullptr) std::cerr << "Invalid scenario: " << problem << std::endl;
+    return problem == nullptr;
+}
@@ -0,0 +1,59 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_SCENARIO_H
+#define SOLAR_SYSTEM_SCENARIO_H
+
+#include <cstdint>
+#include <string>
+
+/** struct Scenario
+ *
+ * The settings which shape a world: how many planets
+ * it has, how populated and fast they are, and so on.
+ * The defaults are the standard game, but they can be
+ * changed at startup from a scenario file, which has
+ * one "key = value" per line, or from the command line.
+ */
+struct Scenario {
+    // The number of planets to generate
+    int numPlanets = 5;
+
+    // The minimum and maximum number of inhabited planets
+    int minInhabited = 2;
+    int maxInhabited = 4;
+
+    // The bounds of possible population.
+    // Note: population also has a chance to be 0
+    int minPopulation = 1000;
+    int maxPopulation = 5000000;
+
+    // The bounds of planet speed
+    float minPlanetSpeed = 25;
+    float maxPlanetSpeed = 40;
+
+    // Ships can only carry this many of each resource
+    int64_t maxCargoPerResource = 5000;
+
+    // 1 game year = timescale real minutes
+    int timescale = 2;
+
+    // The scenario the game is played with
+    static Scenario current;
+
+    // Sets the setting with the given key, e.g. "planets", from its
+    // textual value. Returns false if the key or value isn't valid.
+    bool set(const std::string &key, const std::string &value);
+
+    // Reads each "key = value" line of a scenario file into
+    // this one. Blank lines and lines starting with # are skipped.
+    // Returns false, after printing why, if it can't be read.
+    bool load(const std::string &path);
+
+    // Checks that the settings make sense together, printing
+    // the first problem found if they don't
+    bool validate() const;
+};
+
+#endif //SOLAR_SYSTEM_SCENARIO_H
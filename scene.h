@@ -17,6 +17,8 @@ using namespace std;
  */
 class Scene {
 public:
+    virtual ~Scene() = default;
+
     virtual Scene *update(float) { return nullptr; };
     virtual void render(sf::RenderWindow*) {};
     virtual Scene *handleEvent(sf::Event*) { return nullptr; };
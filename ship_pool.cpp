@@ -0,0 +1,77 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include "ship_pool.h"
+
+ShipHandle ShipPool::add(const Spaceship &ship) {
+    uint32_t slot;
+
+    // Reuse a free slot if possible
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = slots.size();
+        slots.push_back(Slot{0, 0});
+    }
+
+    slots[slot].index = ships.size();
+    ships.push_back(ship);
+    owners.push_back(slot);
+
+    return ShipHandle{slot, slots[slot].generation};
+}
+
+Spaceship *ShipPool::get(ShipHandle handle) {
+    if (handle.slot >= slots.size() || slots[handle.slot].generation != handle.generation) {
+        return nullptr;
+    }
+
+    return &ships[slots[handle.slot].index];
+}
+
+ShipHandle ShipPool::handleAt(unsigned int index) {
+    uint32_t slot = owners[index];
+    return ShipHandle{slot, slots[slot].generation};
+}
+
+void ShipPool::remove(ShipHandle handle) {
+    // Ignore stale handles, including ones already removed
+    if (get(handle) == nullptr) return;
+
+    slots[handle.slot].generation++;
+    removed.push_back(handle.slot);
+}
+
+void ShipPool::compact() {
+    for (uint32_t slot : removed) {
+        uint32_t index = slots[slot].index;
+        uint32_t last = ships.size() - 1;
+
+        // Move the last ship into the gap
+        if (index != last) {
+            ships[index] = ships[last];
+            owners[index] = owners[last];
+            slots[owners[index]].index = index;
+        }
+
+        ships.pop_back();
+        owners.pop_back();
+        freeSlots.push_back(slot);
+    }
+
+    removed.clear();
+}
+
+void ShipPool::clear() {
+    // Bump every generation, so no old handle works
+    for (auto &slot : slots) slot.generation++;
+
+    freeSlots.clear();
+    for (uint32_t slot = 0; slot < slots.size(); slot++) freeSlots.push_back(slot);
+
+    ships.clear();
+    owners.clear();
+    removed.clear();
+}
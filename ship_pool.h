@@ -0,0 +1,76 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_SHIP_POOL_H
+#define SOLAR_SYSTEM_SHIP_POOL_H
+
+#include <cstdint>
+#include <vector>
+
+#include "spaceship.h"
+
+/** ShipHandle
+ *
+ * Refers to a ship in a ShipPool. The generation is bumped
+ * whenever a slot's ship is removed, so a stale handle can't
+ * reach a different ship which has since reused the slot.
+ */
+struct ShipHandle {
+    uint32_t slot;
+    uint32_t generation;
+};
+
+/** class ShipPool
+ *
+ * Stores ships densely, so iterating over them is linear, while
+ * handing out handles which stay valid as other ships come and go.
+ *
+ * Removing a ship only marks it. It's actually removed (by swapping
+ * the last ship into its place) in compact(), so it's safe to remove
+ * ships while iterating over the pool.
+ */
+class ShipPool {
+    struct Slot {
+        uint32_t index;      // Where the slot's ship is in ships
+        uint32_t generation;
+    };
+
+    // The ships, and the slot each one belongs to
+    std::vector<Spaceship> ships;
+    std::vector<uint32_t> owners;
+
+    std::vector<Slot> slots;
+    std::vector<uint32_t> freeSlots;
+
+    // The slots whose ships are waiting to be compacted away
+    std::vector<uint32_t> removed;
+
+public:
+    // Adds a ship, returning its handle
+    ShipHandle add(const Spaceship&);
+
+    // Gets the ship a handle refers to, or nullptr if it's been removed
+    Spaceship *get(ShipHandle);
+
+    // Gets the handle of the ship at the given index
+    ShipHandle handleAt(unsigned int);
+
+    // Marks a ship for removal. Its handle stops working
+    // immediately, but the ship stays put until compact().
+    void remove(ShipHandle);
+
+    // Removes the marked ships
+    void compact();
+
+    // Removes every ship
+    void clear();
+
+    unsigned int size() { return ships.size(); }
+    Spaceship &operator[](unsigned int i) { return ships[i]; }
+
+    std::vector<Spaceship>::iterator begin() { return ships.begin(); }
+    std::vector<Spaceship>::iterator end() { return ships.end(); }
+};
+
+#endif //SOLAR_SYSTEM_SHIP_POOL_H
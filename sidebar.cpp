@@ -2,79 +2,90 @@
 // Created by Zac G on 08/10/2017.
 //
 
+#include "assets.h"
 #include "sidebar.h"
+#include "game.h"
 
-std::string formatNumber(long long n) {
-    return std::to_string(n);
+/*************/
+/** Sidebar **/
+/*************/
+
+bool Sidebar::changed(Planet *planet, ResourceType type) {
+    uint32_t version = planet->getVersion(type);
+    if (version == shown[type]) return false;
+
+    shown[type] = version;
+    return true;
+}
+
+void Sidebar::forget(Planet *planet) {
+    for (int type = 0; type < NUM_RESOURCE_TYPES; type++) {
+        shown[type] = planet->getVersion(ResourceType(type)) - 1;
+    }
 }
 
 /*********************/
 /** PlanetInspector **/
 /*********************/
 
-PlanetInspector::PlanetInspector(Planet *planet)
-    : timeLastUpdate(0.0f) {
+PlanetInspector::PlanetInspector() {
 
-    body.loadFromFile("../assets/fonts/Cabin-Regular.ttf");
-    header.loadFromFile("../assets/fonts/Cabin-Bold.ttf");
+    body = &Assets::font(BODY_FONT);
+    header = &Assets::font(HEADER_FONT);
 
-    this->planet = planet;
+    // Initialise and add all the widgets. Their
+    // values are filled in by setPlanet.
 
-    if (planet != nullptr) {
-
-        // Initialise and add all the widgets
-
-        title = TitleWidget(&header, planet->name);
-
-        widgets.addWidget(&title);
-        widgets.addWidget(&space);
-
-        physical = TextWidget(&header, "Physical Properties", true);
-        distance = TextWidget(&body, "Distance from sun: " + formatNumber(int(planet->distanceFromSun / 80)) + " AU", false);
-        radius = TextWidget(&body, "Radius: " + formatNumber(int(planet->radius)) + " m", false);
-        mass = TextWidget(&body, "Mass: " + formatNumber(int(planet->mass * 1E-24)) + " yg", false);
-        speed = TextWidget(&body, "Speed: " + formatNumber(int(planet->speed)) + " miles/s", false);
-        gravity = TextWidget(&body, "Gravity: " + formatNumber(int(planet->gravity)) + " g", false);
-
-        widgets.addWidget(&physical);
-        widgets.addWidget(&distance);
-        widgets.addWidget(&radius);
-        widgets.addWidget(&mass);
-        widgets.addWidget(&speed);
-        widgets.addWidget(&gravity);
-        widgets.addWidget(&space);
-
-        life = TextWidget(&header, "Life", true);
-        population = TextWidget(&body, "Population: " + formatNumber(planet->resources.store[Population]) + " inhabitants", false);
-        species = TextWidget(&body, "Species: " + formatNumber(planet->resources.store[Species]) + " species", false);
-        inhabitants = TextWidget(&body, "Inhabitants: " + planet->getInhabitantName(), false);
-        biodiversity = TextWidget(&body, "Biodiveristy: " + formatNumber(int(planet->biodiversity)), false);
-
-        widgets.addWidget(&life);
-        widgets.addWidget(&population);
-        widgets.addWidget(&species);
-        widgets.addWidget(&inhabitants);
-        widgets.addWidget(&biodiversity);
-        widgets.addWidget(&space);
-
-        resources = TextWidget(&header, "Resources", true);
-        metal = TextWidget(&body, "Metal: " + formatNumber(planet->resources.store[Metal]) + " tons", false);
-        wood = TextWidget(&body, "Wood: " + formatNumber(planet->resources.store[Wood]) + " tons", false);
-        water = TextWidget(&body, "Water: " + formatNumber(planet->resources.store[Water]) + " cubic feet", false);
-        food = TextWidget(&body, "Food: " + formatNumber(planet->resources.store[Food]) + " tons", false);
-        weaponary = TextWidget(&body, "Weaponry: " + formatNumber(planet->resources.store[Weaponary]) + " units", false);
-
-        widgets.addWidget(&resources);
-        widgets.addWidget(&metal);
-        widgets.addWidget(&wood);
-        widgets.addWidget(&water);
-        widgets.addWidget(&food);
-        widgets.addWidget(&weaponary);
-    }
+    title = TitleWidget(header, "");
+
+    widgets.addWidget(&title);
+    widgets.addWidget(&space);
+
+    physical = TextWidget(header, "Physical Properties", true);
+    distance = TextWidget(body, "", false);
+    radius = TextWidget(body, "", false);
+    mass = TextWidget(body, "", false);
+    speed = TextWidget(body, "", false);
+    gravity = TextWidget(body, "", false);
+
+    widgets.addWidget(&physical);
+    widgets.addWidget(&distance);
+    widgets.addWidget(&radius);
+    widgets.addWidget(&mass);
+    widgets.addWidget(&speed);
+    widgets.addWidget(&gravity);
+    widgets.addWidget(&space);
+
+    life = TextWidget(header, "Life", true);
+    population = TextWidget(body, "", false);
+    species = TextWidget(body, "", false);
+    inhabitants = TextWidget(body, "", false);
+    biodiversity = TextWidget(body, "", false);
+
+    widgets.addWidget(&life);
+    widgets.addWidget(&population);
+    widgets.addWidget(&species);
+    widgets.addWidget(&inhabitants);
+    widgets.addWidget(&biodiversity);
+    widgets.addWidget(&space);
+
+    resources = TextWidget(header, "Resources", true);
+    metal = TextWidget(body, "", false);
+    wood = TextWidget(body, "", false);
+    water = TextWidget(body, "", false);
+    food = TextWidget(body, "", false);
+    weaponary = TextWidget(body, "", false);
+
+    widgets.addWidget(&resources);
+    widgets.addWidget(&metal);
+    widgets.addWidget(&wood);
+    widgets.addWidget(&water);
+    widgets.addWidget(&food);
+    widgets.addWidget(&weaponary);
 
     // Create noPlanet - an sf::Text which is displayed when
     // this sidebar is active, but no planet is selected.
-    noPlanet.setFont(header);
+    noPlanet.setFont(*header);
     noPlanet.setString("No planet selected...");
     noPlanet.setCharacterSize(N(20));
     noPlanet.setFillColor(sf::Color(NO_PLANET_FG));
@@ -89,6 +100,24 @@ PlanetInspector::PlanetInspector(Planet *planet)
     background.setFillColor(sf::Color(SIDEBAR_BG));
 }
 
+void PlanetInspector::setPlanet(Planet *planet) {
+    this->planet = planet;
+
+    if (planet == nullptr) return;
+
+    // These never change, so they're only set here
+    title.setString(planet->name);
+    distance.setString(TextBuffer().append("Distance from sun: ").appendNumber(int(planet->getDistanceFromSun() / 80)).append(" AU"));
+    radius.setString(TextBuffer().append("Radius: ").appendNumber(int(planet->radius)).append(" m"));
+    mass.setString(TextBuffer().append("Mass: ").appendNumber(int(planet->mass * 1E-24)).append(" yg"));
+    speed.setString(TextBuffer().append("Speed: ").appendNumber(int(planet->getSpeed())).append(" miles/s"));
+    gravity.setString(TextBuffer().append("Gravity: ").appendNumber(int(planet->gravity)).append(" g"));
+    biodiversity.setString(TextBuffer().append("Biodiveristy: ").appendNumber(int(planet->getBiodiversity())));
+
+    forget(planet);
+    updateWidgets();
+}
+
 void PlanetInspector::render(sf::RenderWindow *win) {
     Sidebar::render(win);
 
@@ -100,39 +129,25 @@ void PlanetInspector::render(sf::RenderWindow *win) {
 }
 
 void PlanetInspector::update(float dt) {
-    if (nullptr == planet) {
-        timeLastUpdate = 0.0f;
-        return;
-    }
-
-    timeLastUpdate += dt;
-    if (timeLastUpdate >= SIDEBAR_UPDATE_TIME_S) {
-        timeLastUpdate -= SIDEBAR_UPDATE_TIME_S;
-        updateWidgets();
-    }
+    updateWidgets();
 }
 
 void PlanetInspector::updateWidgets() {
     if (nullptr == planet)
         return;
 
-    distance.setString("Distance from sun: " + formatNumber(int(planet->distanceFromSun / 80)) + " AU");
-    radius.setString("Radius: " + formatNumber(int(planet->radius)) + " m");
-    mass.setString("Mass: " + formatNumber(int(planet->mass * 1E-24)) + " yg");
-    speed.setString("Speed: " + formatNumber(int(planet->speed)) + " miles/s");
-    gravity.setString("Gravity: " + formatNumber(int(planet->gravity)) + " g");
-
-    population.setString("Population: " + formatNumber(planet->resources.store[Population]) + " inhabitants");
-    species.setString("Species: " + formatNumber(planet->resources.store[Species]) + " species");
-    inhabitants.setString("Inhabitants: " + planet->getInhabitantName());
-    biodiversity.setString("Biodiveristy: " + formatNumber(int(planet->biodiversity)));
-
-    metal.setString("Metal: " + formatNumber(planet->resources.store[Metal]) + " tons");
-    wood.setString("Wood: " + formatNumber(planet->resources.store[Wood]) + " tons");
-    water.setString("Water: " + formatNumber(planet->resources.store[Water]) + " cubic feet");
-    //populationResource.setString("Population: " + formatNumber(planet->resources.store[Population]) + " inhabitants");
-    food.setString("Food: " + formatNumber(planet->resources.store[Food]) + " tons");
-    weaponary.setString("Weaponry: " + formatNumber(planet->resources.store[Weaponary]) + " units");
+    if (changed(planet, Population)) {
+        population.setString(TextBuffer().append("Population: ").appendNumber(planet->resource(Population)).append(" inhabitants"));
+        inhabitants.setString(TextBuffer().append("Inhabitants: ").append(planet->getInhabitantName()));
+    }
+
+    if (changed(planet, Species)) species.setString(TextBuffer().append("Species: ").appendNumber(planet->resource(Species)).append(" species"));
+
+    if (changed(planet, Metal)) metal.setString(TextBuffer().append("Metal: ").appendNumber(planet->resource(Metal)).append(" tons"));
+    if (changed(planet, Wood)) wood.setString(TextBuffer().append("Wood: ").appendNumber(planet->resource(Wood)).append(" tons"));
+    if (changed(planet, Water)) water.setString(TextBuffer().append("Water: ").appendNumber(planet->resource(Water)).append(" cubic feet"));
+    if (changed(planet, Food)) food.setString(TextBuffer().append("Food: ").appendNumber(planet->resource(Food)).append(" tons"));
+    if (changed(planet, Weaponary)) weaponary.setString(TextBuffer().append("Weaponry: ").appendNumber(planet->resource(Weaponary)).append(" units"));
 }
 
 
@@ -140,27 +155,28 @@ void PlanetInspector::updateWidgets() {
 /** ShipDesigner **/
 /******************/
 
-ShipDesigner::ShipDesigner(Game *game, Planet *sender, Planet *destination): sender(sender), destination(destination) {
-    // Load the required fonts
-    body.loadFromFile("../assets/fonts/Cabin-Regular.ttf");
-    header.loadFromFile("../assets/fonts/Cabin-Bold.ttf");
+ShipDesigner::ShipDesigner(Game *game) {
+    // Get the required fonts
+    body = &Assets::font(BODY_FONT);
+    header = &Assets::font(HEADER_FONT);
 
-    // Create and add the widgets
-    title = TitleWidget(&header, "Ship Designer");
+    // Create and add the widgets. The planets' names and
+    // the sliders' ranges are filled in by setPlanets.
+    title = TitleWidget(header, "Ship Designer");
 
     widgets.addWidget(&title);
     widgets.addWidget(&space);
 
-    planetsText = TextWidget(&header, sender->name + " to " + destination->name, true);
+    planetsText = TextWidget(header, "", true);
 
     widgets.addWidget(&planetsText);
     widgets.addWidget(&space);
 
-    resourcesHeader = TextWidget(&header, "Sender's Resources", true);
-    metal = TextWidget(&body, "Metal:", false);
-    population = TextWidget(&body, "Population:", false);
-    food = TextWidget(&body, "Food:", false);
-    weaponary = TextWidget(&body, "Weaponary:", false);
+    resourcesHeader = TextWidget(header, "Sender's Resources", true);
+    metal = TextWidget(body, "Metal:", false);
+    population = TextWidget(body, "Population:", false);
+    food = TextWidget(body, "Food:", false);
+    weaponary = TextWidget(body, "Weaponary:", false);
 
     widgets.addWidget(&resourcesHeader);
     widgets.addWidget(&metal);
@@ -169,10 +185,10 @@ ShipDesigner::ShipDesigner(Game *game, Planet *sender, Planet *destination): sen
     widgets.addWidget(&weaponary);
     widgets.addWidget(&space);
 
-    metalSlider = SliderWidget(&body, "Metal", 0, min(MAX_CARGO_PER_RESOURCE, sender->resources.store[Metal] - SHIP_METAL_USAGE));
-    populationSlider = SliderWidget(&body, "People", 0, min(MAX_CARGO_PER_RESOURCE, sender->resources.store[Population]));
-    foodSlider = SliderWidget(&body, "Food", 0, min(MAX_CARGO_PER_RESOURCE, sender->resources.store[Food]));
-    weaponarySlider = SliderWidget(&body, "Weaponary", 0, min(MAX_CARGO_PER_RESOURCE, sender->resources.store[Weaponary]));
+    metalSlider = SliderWidget(body, "Metal", 0, 0);
+    populationSlider = SliderWidget(body, "People", 0, 0);
+    foodSlider = SliderWidget(body, "Food", 0, 0);
+    weaponarySlider = SliderWidget(body, "Weaponary", 0, 0);
 
     widgets.addWidget(&metalSlider);
     widgets.addWidget(&populationSlider);
@@ -180,23 +196,20 @@ ShipDesigner::ShipDesigner(Game *game, Planet *sender, Planet *destination): sen
     widgets.addWidget(&weaponarySlider);
     widgets.addWidget(&space);
 
-    launch = ButtonWidget(&header, "Launch");
+    launch = ButtonWidget(header, "Launch");
 
     // When launch is clicked, launch a ship from the sender
-    // containing the specified resources. Also, remove this sidebar,
-    // defaulting back to the 'No planet selected' sidebar.
+    // containing the specified resources, if it can afford them.
+    // Also, remove this sidebar, defaulting back to the 'No planet
+    // selected' sidebar.
     launch.callback = [=] {
         Resources resources;
-        resources.store = {
-                {Metal, metalSlider.value},
-                {Population, populationSlider.value},
-                {Food, foodSlider.value},
-                {Weaponary, weaponarySlider.value}
-        };
+        resources.store[Metal] = metalSlider.value;
+        resources.store[Population] = populationSlider.value;
+        resources.store[Food] = foodSlider.value;
+        resources.store[Weaponary] = weaponarySlider.value;
 
-        sender->resources.store[Metal] -= SHIP_METAL_USAGE;
-
-        if (sender->resources > resources) sender->launchShip(resources, destination);
+        game->launchShip(sender, destination, resources);
 
         // Change the sidebar to a 'No planet selected' one
         game->removeSidebar();
@@ -204,14 +217,26 @@ ShipDesigner::ShipDesigner(Game *game, Planet *sender, Planet *destination): sen
 
     widgets.addWidget(&launch);
 
-    // Initial widget update
-    updateWidgets();
-
     // Create the background
     background = sf::RectangleShape(sf::Vector2f(SIDEBAR_WIDTH, HEIGHT));
     background.setFillColor(sf::Color(SIDEBAR_BG));
 }
 
+void ShipDesigner::setPlanets(Planet *sender, Planet *destination) {
+    this->sender = sender;
+    this->destination = destination;
+
+    planetsText.setString(TextBuffer().append(sender->name).append(" to ").append(destination->name));
+
+    metalSlider.setRange(0, min(MAX_CARGO_PER_RESOURCE, sender->resource(Metal) - SHIP_METAL_USAGE));
+    populationSlider.setRange(0, min(MAX_CARGO_PER_RESOURCE, sender->resource(Population)));
+    foodSlider.setRange(0, min(MAX_CARGO_PER_RESOURCE, sender->resource(Food)));
+    weaponarySlider.setRange(0, min(MAX_CARGO_PER_RESOURCE, sender->resource(Weaponary)));
+
+    forget(sender);
+    updateWidgets();
+}
+
 void ShipDesigner::render(sf::RenderWindow *win) {
     Sidebar::render(win);
 
@@ -220,12 +245,7 @@ void ShipDesigner::render(sf::RenderWindow *win) {
 
 void ShipDesigner::update(float dt) {
     widgets.update(dt);
-
-    timeLastUpdate += dt;
-    if (timeLastUpdate >= SIDEBAR_UPDATE_TIME_S) {
-        timeLastUpdate -= SIDEBAR_UPDATE_TIME_S;
-        updateWidgets();
-    }
+    updateWidgets();
 }
 
 void ShipDesigner::handleEvent(sf::Event *event) {
@@ -233,9 +253,10 @@ void ShipDesigner::handleEvent(sf::Event *event) {
 }
 
 void ShipDesigner::updateWidgets() {
-    // Update the values of the sender resource indicators
-    metal.setString("Metal: " + formatNumber(sender->resources.store[Metal]));
-    population.setString("Population: " + formatNumber(sender->resources.store[Population]));
-    food.setString("Food: " + formatNumber(sender->resources.store[Food]));
-    weaponary.setString("Weaponary: " + formatNumber(sender->resources.store[Weaponary]));
+    // Update the values of the sender resource indicators which have
+    // changed, with SI suffixes to keep them short
+    if (changed(sender, Metal)) metal.setString(TextBuffer().append("Metal: ").appendCompact(sender->resource(Metal)));
+    if (changed(sender, Population)) population.setString(TextBuffer().append("Population: ").appendCompact(sender->resource(Population)));
+    if (changed(sender, Food)) food.setString(TextBuffer().append("Food: ").appendCompact(sender->resource(Food)));
+    if (changed(sender, Weaponary)) weaponary.setString(TextBuffer().append("Weaponary: ").appendCompact(sender->resource(Weaponary)));
 }
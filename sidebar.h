@@ -27,7 +27,20 @@ class Sidebar {
 protected:
     sf::RectangleShape background;
 
+    // The version of each of a planet's resource counts
+    // as of the last time they were shown
+    uint32_t shown[NUM_RESOURCE_TYPES];
+
+    // Checks whether the planet's count of the resource has
+    // changed since it was last shown, marking it as shown
+    bool changed(Planet*, ResourceType);
+
+    // Forgets what's been shown, so everything is shown again
+    void forget(Planet*);
+
 public:
+    virtual ~Sidebar() = default;
+
     virtual void render(sf::RenderWindow *win) { win->draw(background); }
     virtual void update(float dt) {};
     virtual void handleEvent(sf::Event *event) {};
@@ -40,9 +53,13 @@ public:
  *
  * If no planet is selected, it displays a 'No
  * planet selected' message.
+ *
+ * The game keeps one for its whole life, and points
+ * it at whichever planet is selected, reusing the
+ * widgets.
  */
 class PlanetInspector : public Sidebar {
-    sf::Font body, header;
+    sf::Font *body, *header;
     sf::Text noPlanet;
 
     TitleWidget title;
@@ -53,16 +70,19 @@ class PlanetInspector : public Sidebar {
             life, population, inhabitants, species, biodiversity,
             resources, metal, populationResource, food, wood, water, weaponary;
 
-    float timeLastUpdate;
-
 public:
     Planet *planet = nullptr;
 
-    explicit PlanetInspector(Planet*);
+    PlanetInspector();
     void render(sf::RenderWindow*) override;
     void update(float dt) override;
 
+    // Shows the given planet, or the 'No planet selected'
+    // message if it's null
+    void setPlanet(Planet*);
+
 private:
+    // Shows the planet's resource counts which have changed
     void updateWidgets();
 };
 
@@ -73,9 +93,12 @@ private:
  *
  * It allows the player to select how many resources
  * they want to send, and launch a spaceship over.
+ *
+ * Like the PlanetInspector, the game only has one,
+ * which is pointed at each new pair of planets.
  */
 class ShipDesigner : public Sidebar {
-    sf::Font body, header;
+    sf::Font *body, *header;
 
     TitleWidget title;
     SpaceWidget space;
@@ -88,14 +111,15 @@ class ShipDesigner : public Sidebar {
     TextWidget resourcesHeader, planetsText,
             metal, population, food, weaponary;
 
-    float timeLastUpdate;
-
     void updateWidgets();
 
 public:
-    Planet *sender, *destination;
+    Planet *sender = nullptr, *destination = nullptr;
+
+    explicit ShipDesigner(Game*);
 
-    explicit ShipDesigner(Game*, Planet*, Planet*);
+    // Starts designing a ship from sender to destination
+    void setPlanets(Planet *sender, Planet *destination);
     void render(sf::RenderWindow*) override;
     void update(float dt) override;
     void handleEvent(sf::Event *event) override;
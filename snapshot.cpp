@@ -0,0 +1,173 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "snapshot.h"
+
+static const char snapshotMagic[8] = {'S', 'O', 'L', 'A', 'R', 'S', 'Y', 'S'};
+
+// Written as a number, so it reads back differently in the other byte order
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+// Zeroes to pad sections out to SNAPSHOT_ALIGNMENT with
+static const char padding[SNAPSHOT_ALIGNMENT] = {};
+
+static uint64_t alignUp(uint64_t offset) {
+    return (offset + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+}
+
+SnapshotWriter::SnapshotWriter(const SnapshotHeader &header): header(header) {}
+
+void SnapshotWriter::add(uint32_t id, const void *section, uint64_t size) {
+    // Sections are always added in order
+    if (id != data.size()) return;
+
+    data.push_back(section);
+    sizes.push_back(size);
+}
+
+bool SnapshotWriter::write(const std::string &path) {
+    if (data.size() != NUM_SNAPSHOT_SECTIONS) {
+        std::cerr << "Couldn't save " << path << ": the snapshot is missing sections" << std::endl;
+        return false;
+    }
+
+    memcpy(header.magic, snapshotMagic, sizeof(snapshotMagic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+
+    // Lay the sections out one after another, each aligned, with
+    // the padding between them as their own parts of the write
+    std::vector<iovec> parts;
+    uint64_t offset = sizeof(SnapshotHeader);
+
+    parts.push_back({&header, sizeof(SnapshotHeader)});
+
+    for (unsigned int id = 0; id < NUM_SNAPSHOT_SECTIONS; id++) {
+        uint64_t start = alignUp(offset);
+        if (start > offset) parts.push_back({const_cast<char*>(padding), size_t(start - offset)});
+
+        header.offsets[id] = start;
+        header.sizes[id] = sizes[id];
+
+        if (sizes[id] > 0) parts.push_back({const_cast<void*>(data[id]), size_t(sizes[id])});
+        offset = start + sizes[id];
+    }
+
+    // Write to a temporary file first, so a failed save
+    // never leaves a broken snapshot behind
+    std::string temporary = path + ".tmp";
+    int file = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (file < 0) {
+        std::cerr << "Couldn't save " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    // A single write may stop part way through (and can only take so
+    // many parts), so it's continued from wherever it got to
+    size_t next = 0;
+    bool failed = false;
+
+    while (next < parts.size()) {
+        int count = int(std::min(parts.size() - next, size_t(IOV_MAX)));
+        ssize_t written = writev(file, &parts[next], count);
+
+        if (written < 0) {
+            if (errno == EINTR) continue;
+
+            failed = true;
+            break;
+        }
+
+        while (next < parts.size() && size_t(written) >= parts[next].iov_len) {
+            written -= parts[next].iov_len;
+            next++;
+        }
+
+        if (written > 0) {
+            parts[next].iov_base = static_cast<char*>(parts[next].iov_base) + written;
+            parts[next].iov_len -= written;
+        }
+    }
+
+    if (failed || close(file) != 0 || rename(temporary.c_str(), path.c_str()) != 0) {
+        std::cerr << "Couldn't save " << path << ": " << strerror(errno) << std::endl;
+        unlink(temporary.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+Snapshot::~Snapshot() {
+    munmap(base, length);
+}
+
+std::shared_ptr<Snapshot> Snapshot::open(const std::string &path) {
+    int file = ::open(path.c_str(), O_RDONLY);
+    struct stat info;
+
+    if (file < 0 || fstat(file, &info) != 0) {
+        std::cerr << "Couldn't load " << path << ": " << strerror(errno) << std::endl;
+        if (file >= 0) close(file);
+        return nullptr;
+    }
+
+    size_t length = size_t(info.st_size);
+
+    if (length < sizeof(SnapshotHeader)) {
+        std::cerr << "Couldn't load " << path << ": it isn't a snapshot" << std::endl;
+        close(file);
+        return nullptr;
+    }
+
+    // Map it privately, so the game can write over the pages
+    // it uses in place, without them going back to the file
+    void *base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    close(file);
+
+    if (base == MAP_FAILED) {
+        std::cerr << "Couldn't load " << path << ": " << strerror(errno) << std::endl;
+        return nullptr;
+    }
+
+    std::shared_ptr<Snapshot> snapshot(new Snapshot(base, length));
+    const SnapshotHeader &header = snapshot->header();
+    const char *problem = nullptr;
+
+    if (memcmp(header.magic, snapshotMagic, sizeof(snapshotMagic)) != 0) {
+        problem = "it isn't a snapshot";
+    } else if (header.version != SNAPSHOT_VERSION) {
+        problem = "it's from a different version of the game";
+    } else if (header.byteOrder != SNAPSHOT_BYTE_ORDER) {
+        problem = "it was saved on a different kind of machine";
+    }
+
+    for (unsigned int id = 0; id < NUM_SNAPSHOT_SECTIONS && problem == nullptr; id++) {
+        uint64_t offset = header.offsets[id], size = header.sizes[id];
+
+        if (offset % SNAPSHOT_ALIGNMENT != 0 || offset > length || size > length - offset) {
+            problem = "it's been cut short or corrupted";
+        }
+    }
+
+    if (problem != nullptr) {
+        std::cerr << "Couldn't load " << path << ": " << problem << std::endl;
+        return nullptr;
+    }
+
+    return snapshot;
+}
@@ -0,0 +1,177 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_SNAPSHOT_H
+#define SOLAR_SYSTEM_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resource.h"
+
+// Bumped whenever the layout of a snapshot changes, so
+// old snapshots are refused rather than misread
+#define SNAPSHOT_VERSION 2
+
+// Every section starts on a boundary of this many bytes,
+// so the arrays in a mapped snapshot are all aligned
+#define SNAPSHOT_ALIGNMENT 64
+
+/** SnapshotSection
+ *
+ * The sections of a snapshot. Each is one flat array, which
+ * is stored exactly as it is in memory.
+ */
+enum SnapshotSection : uint32_t {
+    // The PlanetStore's arrays, one float per planet each
+    AngleSection,
+    SpeedSection,
+    AngularSpeedSection,
+    DistanceSection,
+    CapacitySection,
+    BiodiversitySection,
+    PixelRadiusSection,
+    XSection,
+    YSection,
+
+    // The resource counts, in one section per ResourceType,
+    // with an int64_t per planet
+    ResourcesSection,
+
+    // A SnapshotPlanet per planet, and the names they refer to
+    PlanetsSection = ResourcesSection + NUM_RESOURCE_TYPES,
+    NamesSection,
+
+    // The upper triangle of the relationship graph, and each
+    // planet's reputation as of the last update
+    RelationshipsSection,
+    ReputationsSection,
+
+    // A SnapshotShip per ship in flight
+    ShipsSection,
+
+    NUM_SNAPSHOT_SECTIONS
+};
+
+/** struct SnapshotHeader
+ *
+ * The start of every snapshot: what it is, the game's clock
+ * and counts, and where each section is.
+ */
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+
+    // Snapshots are only read on machines with the same
+    // byte order as the one which wrote them
+    uint32_t byteOrder;
+
+    uint32_t planets;
+    uint32_t ships;
+    int32_t timeWarp;
+
+    // The display the positions were saved at. They're
+    // scaled to fit the display they're loaded on.
+    float widthRatio;
+    float systemX, systemY;
+
+    uint64_t seed;
+    uint64_t elapsed;
+    uint64_t tick;
+
+    // The offset and size (in bytes) of each section
+    uint64_t offsets[NUM_SNAPSHOT_SECTIONS];
+    uint64_t sizes[NUM_SNAPSHOT_SECTIONS];
+};
+
+/** struct SnapshotPlanet
+ *
+ * The properties of a planet which never change. Its names
+ * are stored as offsets into the names section.
+ */
+struct SnapshotPlanet {
+    float earthLikeness;
+    float radius;
+    float mass;
+    float gravity;
+    uint32_t colour;
+    uint32_t name;
+    uint32_t inhabitants;
+};
+
+/** struct SnapshotShip
+ *
+ * A ship in flight, which refers to its planets by index.
+ */
+struct SnapshotShip {
+    uint32_t sender, destination;
+    float originX, originY;
+    float interceptX, interceptY;
+    uint64_t departure;
+    uint64_t arrival;
+    int64_t resources[NUM_RESOURCE_SLOTS];
+};
+
+/** class SnapshotWriter
+ *
+ * Collects the sections of a snapshot, without copying them,
+ * and then writes the whole file at once.
+ */
+class SnapshotWriter {
+    SnapshotHeader header;
+
+    // The data and size of each section, in order
+    std::vector<const void*> data;
+    std::vector<uint64_t> sizes;
+
+public:
+    // Starts a snapshot with the given header. Its magic, version
+    // and section table are filled in as it's written.
+    explicit SnapshotWriter(const SnapshotHeader&);
+
+    // Adds the next section, which must stay alive until written
+    void add(uint32_t section, const void *data, uint64_t size);
+
+    // Writes the header and every section to the given path, in a
+    // single sequential write. Returns false, after printing why,
+    // if it can't be written.
+    bool write(const std::string &path);
+};
+
+/** class Snapshot
+ *
+ * A snapshot file mapped into memory. Its sections are read
+ * straight out of the mapping, so nothing is read from disk
+ * until it's used. The mapping is private, so its pages can
+ * be written to without changing the file.
+ */
+class Snapshot {
+    void *base;
+    size_t length;
+
+    Snapshot(void *base, size_t length): base(base), length(length) {}
+
+public:
+    ~Snapshot();
+
+    // Maps the snapshot at the given path, checking its header.
+    // Returns nullptr, after printing why, if it can't be used.
+    static std::shared_ptr<Snapshot> open(const std::string &path);
+
+    const SnapshotHeader &header() const { return *static_cast<const SnapshotHeader*>(base); }
+
+    // Gets a section as an array of count Ts, or nullptr if
+    // it's not that size
+    template <typename T>
+    T *section(uint32_t id, uint64_t count) const {
+        if (header().sizes[id] != count * sizeof(T)) return nullptr;
+
+        return reinterpret_cast<T*>(static_cast<char*>(base) + header().offsets[id]);
+    }
+};
+
+#endif //SOLAR_SYSTEM_SNAPSHOT_H
@@ -4,74 +4,124 @@
 
 #include "spaceship.h"
 
-unsigned int Spaceship::nextID = 0;
-
-Spaceship::Spaceship(Planet *sender, Planet *destination, Resources resources):
+Spaceship::Spaceship(Planet *sender, Planet *destination, Resources resources, uint64_t now):
         sender(sender),
         destination(destination),
         resources(resources) {
 
     // Take required resources from sender
-    sender->resources = sender->resources - resources;
+    sender->setResources(sender->getResources() - resources);
 
     // It hasn't delivered its resources yet
     delivered = false;
 
-    // Assign a unique ID
-    id = nextID++;
-
     // Create CircleShape to render
     shape = sf::CircleShape(SHIP_RADIUS, SHIP_SHAPE);
     shape.setFillColor(sf::Color(SHIP_COLOUR));
     shape.setOrigin(SHIP_RADIUS, SHIP_RADIUS);
 
-    position = sender->getPosition(SYSTEM_CENTER);
-    shape.setPosition(position);
+    origin = sender->getPosition();
+    departure = now;
 
-    // Initial velocity = {0, 0}
-    velocity.x = 0;
-    velocity.y = 0;
+    float eta = predictArrival(origin, &intercept);
+    arrivalTime = now + llround(eta * 1E+6);
 }
 
-// TODO: Maybe add slight acceleration towards the sun, to simulate gravity
-void Spaceship::update(float dt) {
-    // Calculate velocity to apply
-    sf::Vector2f direction = getDirectionToDestination();
-    direction.x *= SHIP_SPEED * dt;
-    direction.y *= SHIP_SPEED * dt;
-
-    // Apply new velocity, divide by drag
-    velocity += direction;
-    velocity.x *= SHIP_DRAG;
-    velocity.y *= SHIP_DRAG;
-
-    // Update position
-    position += velocity;
-    shape.setPosition(position);
-
-    if (hasReachedDestination()) {
-        delivered = true;
+Spaceship::Spaceship(Planet *sender, Planet *destination, Resources resources, sf::Vector2f origin,
+                     sf::Vector2f intercept, uint64_t departure, uint64_t arrival):
+        sender(sender),
+        destination(destination),
+        origin(origin),
+        intercept(intercept),
+        departure(departure),
+        arrivalTime(arrival),
+        delivered(false),
+        resources(resources) {
 
-        // Move resources from sender to destination
-        destination->resources = destination->resources + resources;
-    }
+    shape = sf::CircleShape(SHIP_RADIUS, SHIP_SHAPE);
+    shape.setFillColor(sf::Color(SHIP_COLOUR));
+    shape.setOrigin(SHIP_RADIUS, SHIP_RADIUS);
 }
 
-void Spaceship::render(sf::RenderWindow *win) {
+void Spaceship::render(sf::RenderWindow *win, uint64_t now) {
+    shape.setPosition(getPosition(now));
     win->draw(shape);
 }
 
-sf::Vector2f Spaceship::getDirectionToDestination() {
-    sf::Vector2f dest = destination->getPosition(SYSTEM_CENTER);
-    sf::Vector2f diff = dest - position;
-    float length = sqrtf(diff.x * diff.x + diff.y * diff.y);
+sf::Vector2f Spaceship::getPosition(uint64_t now) {
+    if (now >= arrivalTime) return intercept;
 
-    return diff / length;
+    float progress = float(now - departure) / float(arrivalTime - departure);
+    return origin + (intercept - origin) * progress;
 }
 
-bool Spaceship::hasReachedDestination() {
-    sf::Vector2f diff = destination->getPosition(SYSTEM_CENTER) - position;
+bool Spaceship::hasReachedDestination(uint64_t now) {
+    sf::Vector2f diff = destination->getPosition() - getPosition(now);
     float distance = sqrtf(diff.x * diff.x + diff.y * diff.y);
 
     return distance < destination->getPixelRadius();
 }
+
+void Spaceship::replan(uint64_t now) {
+    origin = getPosition(now);
+    departure = now;
+
+    // Always move the arrival on, so the ship is checked again later
+    float eta = predictArrival(origin, &intercept);
+    arrivalTime = now + std::max(1LL, llround(eta * 1E+6));
+}
+
+void Spaceship::deliver() {
+    delivered = true;
+
+    // Move resources from sender to destination
+    destination->setResources(destination->getResources() + resources);
+}
+
+float Spaceship::predictArrival(sf::Vector2f from, sf::Vector2f *intercept) {
+    float angle = destination->getAngle();
+    float angularSpeed = destination->getAngularSpeed();
+    float distance = destination->getDistanceFromSun();
+    float radius = destination->getPixelRadius();
+    sf::Vector2f center = SYSTEM_CENTER;
+
+    // Where the destination will be in t seconds
+    auto destinationAt = [&](float t) {
+        float a = angle + angularSpeed * t;
+        return center + sf::Vector2f(cosf(a), sinf(a)) * distance;
+    };
+
+    // How far short of the destination the ship would be, if
+    // it flew straight to where it'll be in t seconds
+    auto shortfall = [&](float t) {
+        sf::Vector2f diff = destinationAt(t) - from;
+        return sqrtf(diff.x * diff.x + diff.y * diff.y) - radius - SHIP_CRUISE_SPEED * t;
+    };
+
+    // The destination can't be further away than this, so
+    // the ship must have got there by the time it's flown it
+    sf::Vector2f fromCenter = from - center;
+    float latest = (sqrtf(fromCenter.x * fromCenter.x + fromCenter.y * fromCenter.y) + distance) / SHIP_CRUISE_SPEED;
+
+    // Step through the orbit in small fractions of a turn to find
+    // the first time the ship could be there...
+    float step = angularSpeed > 0 ? std::min(latest, 2 * PI / angularSpeed / 64) : latest;
+    float before = 0, after = 0;
+
+    while (after < latest && shortfall(after) > 0) {
+        before = after;
+        after = std::min(latest, after + step);
+    }
+
+    // ...then narrow it down by bisection
+    for (int i = 0; i < 24 && after > before; i++) {
+        float mid = (before + after) / 2;
+
+        if (shortfall(mid) > 0) before = mid;
+        else after = mid;
+    }
+
+    if (intercept != nullptr) *intercept = destinationAt(after);
+
+    return after;
+}
@@ -6,6 +6,7 @@
 #define SOLAR_SYSTEM_SPACESHIP_H
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 
 #include "config.h"
 #include "planet.h"
@@ -14,28 +15,67 @@
 // Forward declaration of Planet
 class Planet;
 
+/** class Spaceship
+ *
+ * A ship carrying resources from one planet to another.
+ *
+ * When it's launched, the ship predicts where it'll meet its
+ * destination (which is on a known circular orbit) and flies
+ * straight there, so its position is just a function of the time
+ * and nothing needs updating every tick. The game only checks on
+ * the ship once its predicted arrival time has come.
+ */
 class Spaceship {
     sf::CircleShape shape;
     Planet *sender, *destination;
-    sf::Vector2f position, velocity;
 
-    // Gets the direction to the destination planet
-    sf::Vector2f getDirectionToDestination();
+    // The flight path: from origin at departure (in game
+    // microseconds) to intercept at arrivalTime.
+    sf::Vector2f origin, intercept;
+    uint64_t departure;
 
-    // Checks whether the ship has reached its destination
-    bool hasReachedDestination();
+    // Predicts how many seconds it'd take to reach the destination
+    // from the given point, flying straight at SHIP_CRUISE_SPEED to
+    // where the destination will be by then. That point is stored
+    // in intercept, if it isn't null.
+    float predictArrival(sf::Vector2f from, sf::Vector2f *intercept);
 
 public:
-    Spaceship(Planet*, Planet*, Resources);
-    void update(float);
-    void render(sf::RenderWindow*);
+    // Launches a ship at the given game time
+    Spaceship(Planet*, Planet*, Resources, uint64_t now);
+
+    // Puts a ship back on a flight path it was already on, e.g. when
+    // loading. Unlike launching, it takes nothing from the sender.
+    Spaceship(Planet*, Planet*, Resources, sf::Vector2f origin, sf::Vector2f intercept,
+              uint64_t departure, uint64_t arrival);
+    void render(sf::RenderWindow*, uint64_t now);
+
+    // Gets the ship's position at the given game time
+    sf::Vector2f getPosition(uint64_t now);
+
+    // Checks exactly whether the ship has reached its destination
+    bool hasReachedDestination(uint64_t now);
+
+    // Plots a new path to the destination from wherever
+    // the ship is now, updating arrivalTime.
+    void replan(uint64_t now);
+
+    // Gives the ship's resources to the destination
+    void deliver();
+
+    Planet *getSender() { return sender; }
+    Planet *getDestination() { return destination; }
+
+    // Gets the current flight path
+    sf::Vector2f getOrigin() { return origin; }
+    sf::Vector2f getIntercept() { return intercept; }
+    uint64_t getDeparture() { return departure; }
+
+    // When the ship is predicted to reach its destination
+    uint64_t arrivalTime;
 
-    unsigned int id;
     bool delivered;
     Resources resources;
-
-    // The next ID to be assigned to a ship
-    static unsigned int nextID;
 };
 
 #endif //SOLAR_SYSTEM_SPACESHIP_H
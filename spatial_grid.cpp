@@ -0,0 +1,113 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cmath>
+
+#include "spatial_grid.h"
+
+SpatialGrid::SpatialGrid(float width, float height, float cellSize):
+        width(width),
+        height(height),
+        cellSize(cellSize),
+        columns(std::max(1, int(std::ceil(width / cellSize)))),
+        rows(std::max(1, int(std::ceil(height / cellSize)))),
+        cells(size_t(columns) * rows) {}
+
+int SpatialGrid::cellAt(float x, float y) const {
+    int column = std::min(columns - 1, std::max(0, int(std::floor(x / cellSize))));
+    int row = std::min(rows - 1, std::max(0, int(std::floor(y / cellSize))));
+
+    return row * columns + column;
+}
+
+int SpatialGrid::cellFor(float x, float y, float radius) const {
+    if (x + radius < 0 || y + radius < 0 || x - radius > width || y - radius > height) {
+        return -1;
+    }
+
+    return cellAt(x, y);
+}
+
+unsigned int SpatialGrid::countAt(float x, float y) const {
+    return cells.empty() ? 0 : cells[cellAt(x, y)].size();
+}
+
+void SpatialGrid::insert(unsigned int circle, int cell) {
+    cellOf[circle] = cell;
+    if (cell < 0) return;
+
+    slotOf[circle] = cells[cell].size();
+    cells[cell].push_back(circle);
+}
+
+void SpatialGrid::erase(unsigned int circle) {
+    if (cellOf[circle] < 0) return;
+
+    // Swap the last circle in the cell into this one's slot
+    std::vector<unsigned int> &cell = cells[cellOf[circle]];
+    unsigned int last = cell.back();
+
+    cell[slotOf[circle]] = last;
+    slotOf[last] = slotOf[circle];
+    cell.pop_back();
+}
+
+void SpatialGrid::clear() {
+    for (auto &cell : cells) cell.clear();
+
+    cellOf.clear();
+    slotOf.clear();
+    maxRadius = 0;
+}
+
+void SpatialGrid::update(const float *x, const float *y, const float *radius, unsigned int n) {
+    unsigned int known = cellOf.size();
+
+    // Move the circles which have left their cell. Most won't have.
+    for (unsigned int i = 0; i < std::min(known, n); i++) {
+        int cell = cellFor(x[i], y[i], radius[i]);
+
+        if (cell != cellOf[i]) {
+            erase(i);
+            insert(i, cell);
+        }
+    }
+
+    // Drop any circles which have gone
+    for (unsigned int i = n; i < known; i++) erase(i);
+
+    cellOf.resize(n);
+    slotOf.resize(n);
+
+    for (unsigned int i = known; i < n; i++) {
+        insert(i, cellFor(x[i], y[i], radius[i]));
+        maxRadius = std::max(maxRadius, radius[i]);
+    }
+}
+
+int SpatialGrid::find(float px, float py, const float *x, const float *y, const float *radius) const {
+    if (cells.empty()) return -1;
+
+    // Any circle containing the point has its centre within
+    // maxRadius of it, so only those cells need checking
+    int first = cellAt(px - maxRadius, py - maxRadius);
+    int last = cellAt(px + maxRadius, py + maxRadius);
+
+    int found = -1;
+
+    for (int row = first / columns; row <= last / columns; row++) {
+        for (int column = first % columns; column <= last % columns; column++) {
+            for (unsigned int i : cells[row * columns + column]) {
+                float dx = px - x[i], dy = py - y[i];
+
+                if (dx * dx + dy * dy < radius[i] * radius[i] && (found < 0 || int(i) < found)) {
+                    found = i;
+                }
+            }
+        }
+    }
+
+    return found;
+}
@@ -0,0 +1,67 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_SPATIAL_GRID_H
+#define SOLAR_SYSTEM_SPATIAL_GRID_H
+
+#include <vector>
+
+/** class SpatialGrid
+ *
+ * A uniform grid over the screen, bucketing circles (e.g. the
+ * planets) by the cell their centre is in, so finding the one
+ * under a point only has to look at the few cells nearby.
+ *
+ * The circles are given as parallel arrays of positions and
+ * radii, like the ones in a PlanetStore. Each update only
+ * moves the circles which have changed cell. Circles entirely
+ * outside the grid can't be under any point on it, so they're
+ * left out of the cells until they come back.
+ */
+class SpatialGrid {
+    float width = 0, height = 0, cellSize = 1;
+    int columns = 0, rows = 0;
+
+    // The circles in each cell, and where each circle is.
+    // Circles outside the grid have the cell -1.
+    std::vector<std::vector<unsigned int>> cells;
+    std::vector<int> cellOf;
+    std::vector<unsigned int> slotOf;
+
+    // The largest radius, which bounds how far a
+    // circle can reach outside its cell
+    float maxRadius = 0;
+
+    // The cell containing the point, clamped to the grid
+    int cellAt(float x, float y) const;
+
+    // The cell a circle belongs in, or -1 if it's entirely
+    // outside the grid
+    int cellFor(float x, float y, float radius) const;
+
+    void insert(unsigned int circle, int cell);
+    void erase(unsigned int circle);
+
+public:
+    SpatialGrid() = default;
+    SpatialGrid(float width, float height, float cellSize);
+
+    // The number of circles in the cell at the point, clamped
+    // to the grid
+    unsigned int countAt(float x, float y) const;
+
+    // Removes every circle
+    void clear();
+
+    // Brings the grid up to date with the n circles, adding any
+    // new ones (which are the ones past the last update's n) and
+    // dropping any past n.
+    void update(const float *x, const float *y, const float *radius, unsigned int n);
+
+    // Finds the circle which contains the point, preferring the one
+    // with the lowest index if they overlap. Returns -1 if none do.
+    int find(float px, float py, const float *x, const float *y, const float *radius) const;
+};
+
+#endif //SOLAR_SYSTEM_SPATIAL_GRID_H
@@ -0,0 +1,26 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_CHECK_H
+#define SOLAR_SYSTEM_CHECK_H
+
+#include <iostream>
+
+/** Checks
+ *
+ * Each test is a small program which runs its checks and
+ * exits with the number that failed, so CTest sees any
+ * failure. A failed check prints where it was and carries on.
+ */
+
+static int failedChecks = 0;
+
+#define CHECK(condition) do { \
+        if (!(condition)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl; \
+            failedChecks++; \
+        } \
+    } while (0)
+
+#endif //SOLAR_SYSTEM_CHECK_H
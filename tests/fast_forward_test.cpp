@@ -0,0 +1,114 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <cmath>
+
+#include "check.h"
+#include "display_metrics.h"
+#include "game.h"
+#include "scenario.h"
+
+// The spread of the relationship graph's edges
+struct EdgeStats {
+    double mean = 0, deviation = 0, clamped = 0;
+
+    explicit EdgeStats(const PlanetRelationships &relationships) {
+        uint64_t count = PlanetRelationships::edgeCount(relationships.size());
+        const float *edges = relationships.edges();
+        double sum = 0, squares = 0;
+
+        for (uint64_t k = 0; k < count; k++) {
+            sum += edges[k];
+            squares += edges[k] * edges[k];
+            clamped += edges[k] <= MIN_PLANET_REL || edges[k] >= MAX_PLANET_REL;
+        }
+
+        mean = sum / count;
+        deviation = std::sqrt(squares / count - mean * mean);
+        clamped /= count;
+    }
+};
+
+// The mean weaponary of the planets with people on them
+static double meanWeaponary(const PlanetStore &store) {
+    double sum = 0;
+    unsigned int inhabited = 0;
+
+    for (unsigned int i = 0; i < store.size(); i++) {
+        if (store.resources[Population][i] > 0) {
+            sum += store.resources[Weaponary][i];
+            inhabited++;
+        }
+    }
+
+    return inhabited > 0 ? sum / inhabited : 0;
+}
+
+// Fast forwards one game and steps another through the same
+// twenty minutes, which should leave their relationships spread
+// out the same way, if not identical
+static void relationshipsMatchStepping() {
+    Scenario::current = Scenario();
+    Scenario::current.numPlanets = 30;
+    Scenario::current.minInhabited = 10;
+    Scenario::current.maxInhabited = 20;
+
+    const double duration = 20 * 60;
+
+    Game jumped(7, true);
+    jumped.fastForward(duration);
+
+    Game stepped(7, true);
+    uint64_t ticks = uint64_t(duration / TICK_LENGTH_S);
+    for (uint64_t i = 0; i < ticks; i++) stepped.step(TICK_LENGTH_S);
+
+    CHECK(jumped.getTick() == stepped.getTick());
+    CHECK(jumped.getElapsed() == stepped.getElapsed());
+
+    EdgeStats a(jumped.getRelationships()), b(stepped.getRelationships());
+
+    CHECK(std::fabs(a.mean - b.mean) < 0.02);
+    CHECK(std::fabs(a.deviation - b.deviation) < 0.02);
+    CHECK(std::fabs(a.clamped - b.clamped) < 0.05);
+}
+
+// Disarms every planet, then jumps one copy of the store ahead
+// and steps the other. Planets with people rearm every tick, so
+// both should end up armed the same amount on average.
+static void weaponaryMatchesStepping() {
+    Scenario::current = Scenario();
+    Scenario::current.numPlanets = 2000;
+    Scenario::current.minInhabited = 1000;
+    Scenario::current.maxInhabited = 1500;
+
+    Game game(11, true);
+
+    PlanetStore jumped = game.getStore();
+    for (auto &count : jumped.resources[Weaponary]) count = 0;
+
+    PlanetStore stepped = jumped;
+    const uint64_t ticks = 600;
+
+    jumped.fastForward(ticks, TICK_LENGTH_S, SYSTEM_X, SYSTEM_Y);
+    for (uint64_t i = 0; i < ticks; i++) stepped.update(TICK_LENGTH_S, SYSTEM_X, SYSTEM_Y);
+
+    double a = meanWeaponary(jumped), b = meanWeaponary(stepped);
+
+    CHECK(std::fabs(a - MAX_WEAPONARY / 2) < 500);
+    CHECK(std::fabs(a - b) < 500);
+
+    // Planets without people never arm
+    for (unsigned int i = 0; i < jumped.size(); i++) {
+        if (jumped.resources[Population][i] == 0) CHECK(jumped.resources[Weaponary][i] == 0);
+    }
+}
+
+int main() {
+    DisplayMetrics::init(true);
+
+    relationshipsMatchStepping();
+    weaponaryMatchesStepping();
+
+    return failedChecks;
+}
@@ -0,0 +1,142 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <algorithm>
+#include <cstdio>
+
+#include "check.h"
+#include "display_metrics.h"
+#include "game.h"
+#include "headless.h"
+#include "journal.h"
+#include "planet_kernels.h"
+#include "scenario.h"
+
+#define JOURNAL_PATH "journal_replay_test.journal"
+
+static JournalHeader makeHeader(uint64_t seed, uint32_t kernelLevel) {
+    JournalHeader header = {};
+    header.desktopWidth = WIDTH_RATIO * ASSUMED_WIDTH;
+    header.seed = seed;
+    header.scenario = Scenario::current;
+    header.kernelLevel = kernelLevel;
+
+    return header;
+}
+
+// Plays a short game on the scalar kernels, journalling it like a
+// game in a window does, then replays it with the kernels put back
+// to the best the CPU has. The replay has to switch back to the
+// scalar ones for the checksums to match.
+static void replayOnCappedKernels() {
+    Scenario::current = Scenario();
+    Scenario::current.numPlanets = 40;
+    Scenario::current.minInhabited = 20;
+    Scenario::current.maxInhabited = 30;
+
+    const uint64_t seed = 5;
+    CHECK(setPlanetKernelLevel(ScalarKernels));
+
+    {
+        Journal journal(JOURNAL_PATH, makeHeader(seed, ScalarKernels));
+        Game game(seed, true);
+
+        // Launch from the planet with the most metal, so it can afford it
+        const std::vector<int64_t> &metal = game.getStore().resources[Metal];
+        unsigned int sender = std::max_element(metal.begin(), metal.end()) - metal.begin();
+
+        for (uint64_t tick = 0; tick < 3000; tick++) {
+            if (tick % 600 == 0) {
+                JournalRecord record = {};
+                record.tick = game.getTick();
+                record.action = ChecksumAction;
+                record.checksum = game.checksum();
+                journal.record(record);
+            }
+
+            if (tick == 300) {
+                JournalRecord record = {};
+                record.tick = game.getTick();
+                record.action = LaunchAction;
+                record.sender = sender;
+                record.destination = (sender + 1) % Scenario::current.numPlanets;
+                record.resources[Metal] = 10;
+
+                CHECK(game.replay(record));
+                journal.record(record);
+            }
+
+            game.step(TICK_LENGTH_S);
+        }
+
+        JournalRecord record = {};
+        record.tick = game.getTick();
+        record.action = ChecksumAction;
+        record.checksum = game.checksum();
+        journal.record(record);
+    }
+
+    CHECK(setPlanetKernelLevel(supportedPlanetKernelLevel()));
+    CHECK(replayJournal(JOURNAL_PATH) == 0);
+    CHECK(planetKernelLevel() == ScalarKernels);
+
+    std::remove(JOURNAL_PATH);
+}
+
+// A journal played on kernels this build doesn't know about
+// can't be checked, so it's refused rather than replayed
+static void refuseUnknownKernels() {
+    Scenario::current = Scenario();
+
+    { Journal journal(JOURNAL_PATH, makeHeader(1, AVX2Kernels + 1)); }
+
+    CHECK(replayJournal(JOURNAL_PATH) == 1);
+
+    std::remove(JOURNAL_PATH);
+}
+
+// The header is written field by field, so it's the same 72 bytes
+// wherever it's written, and every setting comes back as it was
+static void headerIsPortable() {
+    Scenario::current = Scenario();
+    Scenario::current.numPlanets = 123;
+    Scenario::current.maxCargoPerResource = 5000000000LL;
+    Scenario::current.maxPlanetSpeed = 41.5f;
+
+    { Journal journal(JOURNAL_PATH, makeHeader(0x123456789ULL, SSEKernels)); }
+
+    FILE *file = fopen(JOURNAL_PATH, "rb");
+    CHECK(file != nullptr);
+
+    if (file != nullptr) {
+        fseek(file, 0, SEEK_END);
+        CHECK(ftell(file) == 72);
+        fclose(file);
+    }
+
+    JournalHeader header = {};
+    std::vector<JournalRecord> records;
+
+    CHECK(Journal::read(JOURNAL_PATH, header, records));
+    CHECK(records.empty());
+    CHECK(header.seed == 0x123456789ULL);
+    CHECK(header.kernelLevel == SSEKernels);
+    CHECK(header.desktopWidth == WIDTH_RATIO * ASSUMED_WIDTH);
+    CHECK(header.scenario.numPlanets == 123);
+    CHECK(header.scenario.maxCargoPerResource == 5000000000LL);
+    CHECK(header.scenario.maxPlanetSpeed == 41.5f);
+    CHECK(header.scenario.timescale == Scenario().timescale);
+
+    std::remove(JOURNAL_PATH);
+}
+
+int main() {
+    DisplayMetrics::init(true);
+
+    replayOnCappedKernels();
+    refuseUnknownKernels();
+    headerIsPortable();
+
+    return failedChecks;
+}
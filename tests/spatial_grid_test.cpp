@@ -0,0 +1,78 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <vector>
+
+#include "check.h"
+#include "spatial_grid.h"
+
+// Puts most of the circles far off the edges of the grid, as
+// planets are when their orbits are wider than the screen, and
+// checks they don't pile up in the edge cells.
+static void offScreenCircles() {
+    const float width = 1000, height = 700, cell = 50;
+    const unsigned int n = 10000;
+
+    std::vector<float> x(n), y(n), radius(n, 5);
+
+    for (unsigned int i = 0; i < n; i++) {
+        // Cycle round the four sides, well outside the grid
+        float along = float(i % 97) / 97;
+
+        switch (i % 4) {
+            case 0: x[i] = -500 - i; y[i] = along * height; break;
+            case 1: x[i] = width + 500 + i; y[i] = along * height; break;
+            case 2: x[i] = along * width; y[i] = -500 - i; break;
+            default: x[i] = along * width; y[i] = height + 500 + i; break;
+        }
+    }
+
+    // A few on screen, and one just off the edge but still
+    // reaching onto it
+    x[0] = 10; y[0] = 10;
+    x[1] = 500; y[1] = 350;
+    x[2] = -3; y[2] = 350;
+
+    SpatialGrid grid(width, height, cell);
+    grid.update(x.data(), y.data(), radius.data(), n);
+
+    unsigned int edgeCircles = 0;
+
+    for (float px = cell / 2; px < width; px += cell) {
+        edgeCircles += grid.countAt(px, cell / 2) + grid.countAt(px, height - cell / 2);
+    }
+
+    for (float py = cell * 3 / 2; py < height - cell; py += cell) {
+        edgeCircles += grid.countAt(cell / 2, py) + grid.countAt(width - cell / 2, py);
+    }
+
+    CHECK(edgeCircles == 2);
+
+    CHECK(grid.find(10, 10, x.data(), y.data(), radius.data()) == 0);
+    CHECK(grid.find(500, 350, x.data(), y.data(), radius.data()) == 1);
+    CHECK(grid.find(1, 350, x.data(), y.data(), radius.data()) == 2);
+    CHECK(grid.find(990, 350, x.data(), y.data(), radius.data()) == -1);
+
+    // Bring one of the off-screen circles onto the screen, and
+    // send an on-screen one off it
+    x[3] = 700; y[3] = 200;
+    x[1] = -1000;
+    grid.update(x.data(), y.data(), radius.data(), n);
+
+    CHECK(grid.find(700, 200, x.data(), y.data(), radius.data()) == 3);
+    CHECK(grid.find(500, 350, x.data(), y.data(), radius.data()) == -1);
+    CHECK(grid.countAt(500, 350) == 0);
+
+    // Dropping the circles works whether or not they're on the grid
+    grid.update(x.data(), y.data(), radius.data(), 2);
+
+    CHECK(grid.find(10, 10, x.data(), y.data(), radius.data()) == 0);
+    CHECK(grid.find(700, 200, x.data(), y.data(), radius.data()) == -1);
+}
+
+int main() {
+    offScreenCircles();
+
+    return failedChecks;
+}
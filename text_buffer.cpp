@@ -0,0 +1,91 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#include <cstring>
+
+#include "text_buffer.h"
+
+TextBuffer &TextBuffer::clear() {
+    length = 0;
+    text[0] = '\0';
+
+    return *this;
+}
+
+TextBuffer &TextBuffer::append(const char *str) {
+    while (*str != '\0' && length < CAPACITY - 1) text[length++] = *str++;
+    text[length] = '\0';
+
+    return *this;
+}
+
+TextBuffer &TextBuffer::append(const std::string &str) {
+    return append(str.c_str());
+}
+
+TextBuffer &TextBuffer::append(char c) {
+    if (length < CAPACITY - 1) text[length++] = c;
+    text[length] = '\0';
+
+    return *this;
+}
+
+TextBuffer &TextBuffer::appendNumber(long long n) {
+    // Work with the magnitude unsigned, so the most
+    // negative number doesn't overflow
+    unsigned long long magnitude = n < 0 ? 0 - (unsigned long long) n : (unsigned long long) n;
+
+    // Write the digits backwards, with a comma every three
+    char digits[32];
+    int count = 0, written = 0;
+
+    do {
+        if (count > 0 && count % 3 == 0) digits[written++] = ',';
+
+        digits[written++] = char('0' + magnitude % 10);
+        magnitude /= 10;
+        count++;
+    } while (magnitude > 0);
+
+    if (n < 0) append('-');
+    while (written > 0) append(digits[--written]);
+
+    return *this;
+}
+
+TextBuffer &TextBuffer::appendCompact(long long n) {
+    static const char suffixes[] = {'k', 'M', 'G', 'T', 'P', 'E'};
+
+    double magnitude = n < 0 ? -double(n) : double(n);
+    if (magnitude < 1000) return appendNumber(n);
+
+    // Find the suffix, moving up one if rounding would give 1000
+    int suffix = 0;
+    magnitude /= 1000;
+
+    while (magnitude >= 999.5 && suffix < 5) {
+        magnitude /= 1000;
+        suffix++;
+    }
+
+    // Keep three significant figures
+    int decimals = magnitude < 9.995 ? 2 : magnitude < 99.95 ? 1 : 0;
+    long long unit = decimals == 2 ? 100 : decimals == 1 ? 10 : 1;
+    long long scaled = (long long) (magnitude * unit + 0.5);
+
+    if (n < 0) append('-');
+    appendNumber(scaled / unit);
+
+    if (decimals > 0) {
+        append('.');
+        if (decimals == 2) append(char('0' + scaled / 10 % 10));
+        append(char('0' + scaled % 10));
+    }
+
+    return append(suffixes[suffix]);
+}
+
+bool TextBuffer::operator==(const TextBuffer &other) const {
+    return length == other.length && memcmp(text, other.text, length) == 0;
+}
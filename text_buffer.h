@@ -0,0 +1,48 @@
+//
+// Created by Zac G on 18/10/2026.
+//
+
+#ifndef SOLAR_SYSTEM_TEXT_BUFFER_H
+#define SOLAR_SYSTEM_TEXT_BUFFER_H
+
+#include <string>
+
+/** class TextBuffer
+ *
+ * A small fixed-size buffer which labels are formatted
+ * into, so that building one never allocates. Anything
+ * past the end of the buffer is cut off.
+ *
+ *     TextBuffer().append("Metal: ").appendNumber(n).append(" tons")
+ */
+class TextBuffer {
+public:
+    static const unsigned int CAPACITY = 64;
+
+private:
+    char text[CAPACITY];
+    unsigned int length;
+
+public:
+    TextBuffer(): length(0) { text[0] = '\0'; }
+
+    TextBuffer &clear();
+    TextBuffer &append(const char*);
+    TextBuffer &append(const std::string&);
+    TextBuffer &append(char);
+
+    // Appends a whole number with thousands separators, e.g. 1,234,567
+    TextBuffer &appendNumber(long long);
+
+    // Appends a number to three significant figures with an SI
+    // suffix, e.g. 1.23M or 45.6k. Below 1000 it's written in full.
+    TextBuffer &appendCompact(long long);
+
+    const char *c_str() const { return text; }
+    unsigned int size() const { return length; }
+
+    bool operator==(const TextBuffer&) const;
+    bool operator!=(const TextBuffer &other) const { return !(*this == other); }
+};
+
+#endif //SOLAR_SYSTEM_TEXT_BUFFER_H
@@ -7,6 +7,7 @@
 
 TextWidget::TextWidget(sf::Font *font, std::string string, bool isHeader): font(font), string(string), isHeader(isHeader) {
     text = sf::Text(string, *font, REGULAR_FONT_SIZE);
+    shown.append(string);
     text.setFillColor(isHeader ? sf::Color(LIGHT_FG) : sf::Color(REGULAR_FG));
 
     if (isHeader) text.setStyle(sf::Text::Bold);
@@ -24,8 +25,11 @@ void TextWidget::setPosition(float x, float y) {
     text.setPosition(x, y);
 }
 
-void TextWidget::setString(std::string str) {
-    text.setString(str);
+void TextWidget::setString(const TextBuffer &str) {
+    if (str == shown) return;
+
+    shown = str;
+    text.setString(str.c_str());
 }
 
 
@@ -47,6 +51,10 @@ void TitleWidget::setPosition(float x, float y) {
     text.setPosition(x, y);
 }
 
+void TitleWidget::setString(const std::string &str) {
+    text.setString(str);
+}
+
 
 ButtonWidget::ButtonWidget(sf::Font *font, std::string label): font(font), label(label) {
     text = sf::Text(label, *font, REGULAR_FONT_SIZE);
@@ -107,7 +115,7 @@ SliderWidget::SliderWidget(sf::Font *font, std::string string, float min, float
     label = sf::Text(string, *font, REGULAR_FONT_SIZE);
     label.setFillColor(sf::Color(LIGHT_FG));
 
-    valPopover = sf::Text(std::to_string(lround(value)), *font, REGULAR_FONT_SIZE);
+    valPopover = sf::Text("", *font, REGULAR_FONT_SIZE);
     valPopover.setFillColor(sf::Color(LIGHT_FG));
     valPopover.setStyle(sf::Text::Bold);
 
@@ -189,6 +197,15 @@ void SliderWidget::update(float, bool down, float x, float y) {
     }
 }
 
+void SliderWidget::setRange(float min, float max) {
+    this->min = min;
+    this->max = max;
+    value = min;
+    holding = false;
+
+    updateValPopover();
+}
+
 float SliderWidget::getProgress() {
     return (value - min) / (max - min);
 }
@@ -201,7 +218,15 @@ void SliderWidget::setProgress(float prog) {
 }
 
 void SliderWidget::updateValPopover() {
-    valPopover.setString(std::to_string(lround(value)));
+    TextBuffer str;
+    str.appendNumber(lround(value));
+
+    // Only lay the text out again if the number's changed
+    if (str == shownValue) return;
+
+    shownValue = str;
+    valPopover.setString(str.c_str());
+
     sf::FloatRect valBounds = valPopover.getLocalBounds();
     valPopover.setOrigin(valBounds.width / 2, valBounds.height / 2);
 }
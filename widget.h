@@ -11,6 +11,7 @@
 #include <iostream>
 
 #include "config.h"
+#include "text_buffer.h"
 
 /** class Widget
  *
@@ -43,6 +44,7 @@ public:
     void render(sf::RenderWindow*) override;
     float getHeight() override;
     void setPosition(float, float) override;
+    void setString(const std::string &str);
 };
 
 /** TextWidget : public Widget
@@ -55,13 +57,18 @@ class TextWidget : public Widget {
     bool isHeader;
     sf::Text text;
 
+    // The text as last set, to skip setting it again
+    TextBuffer shown;
+
 public:
     TextWidget() = default;
     TextWidget(sf::Font*, std::string, bool);
     void render(sf::RenderWindow*) override;
     float getHeight() override;
     void setPosition(float, float) override;
-    void setString(std::string str);
+
+    // Sets the text, unless it's the same as it already is
+    void setString(const TextBuffer &str);
 };
 
 /** SpaceWidget : public Widget
@@ -111,6 +118,9 @@ class SliderWidget : public Widget {
     float min, max;
     bool holding = false;
 
+    // The value as last shown in the popover
+    TextBuffer shownValue;
+
     float getProgress();
     void setProgress(float);
     void updateValPopover();
@@ -125,6 +135,9 @@ public:
     void setPosition(float x, float y) override;
     void handleEvent(sf::Event*) override;
     void update(float dt, bool down, float x, float y) override;
+
+    // Changes the bounds, moving the value back to min
+    void setRange(float min, float max);
 };
 
 #endif //SOLAR_SYSTEM_WIDGET_H